@@ -0,0 +1,550 @@
+/******************************************************************************/
+/*                                                                            */
+/*  CayleyGraph.cpp: Word lengths over the Cayley graph of a generating set   */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+#include "ParallelStream.h"
+#include "CayleyGraph.h"
+
+// Bitset words handed to a worker at a time
+const uint64_t words_per_chunk = 1024;
+
+typedef enum
+  {
+    SearchPhase_TopDown,
+    SearchPhase_BottomUp,
+    SearchPhase_Merge
+  } SearchPhase_t;
+
+typedef struct
+{
+  SearchPhase_t phase;
+  const CayleyGraph *graph;
+  uint64_t words;
+  std::atomic<uint64_t> *next_chunk;
+  uint64_t *visited;
+  uint64_t *frontier;
+  std::atomic<uint64_t> *next;
+  uint16_t *distances;
+  uint16_t level;
+  // Vertices added to the level by this worker
+  uint64_t found;
+} SearchWorker;
+
+// Bits of the vertices that exist in bitset word w
+static uint64_t
+word_mask(uint64_t w, uint64_t vertex_count)
+{
+  uint64_t first = w * 64;
+
+  if (vertex_count - first >= 64)
+    {
+      return ~0ull;
+    }
+  return (1ull << (vertex_count - first)) - 1;
+}
+
+static void
+search_worker(SearchWorker *work)
+{
+  const CayleyGraph *graph = work->graph;
+  uint64_t vertex_count = graph->size();
+  std::vector<uint64_t> adjacent(std::max(1u, graph->degree()));
+
+  while (1)
+    {
+      uint64_t first = work->next_chunk->fetch_add(words_per_chunk);
+
+      if (first >= work->words)
+        {
+          break;
+        }
+
+      uint64_t last = std::min(first + words_per_chunk, work->words);
+
+      for (uint64_t w = first; w < last; w++)
+        {
+          switch (work->phase)
+            {
+            case SearchPhase_TopDown:
+              for (uint64_t bits = work->frontier[w]; bits != 0; bits &= bits - 1)
+                {
+                  graph->neighbours(w * 64 + __builtin_ctzll(bits), false, adjacent.data());
+                  for (uint32_t s = 0; s < graph->degree(); s++)
+                    {
+                      uint64_t u = adjacent[s];
+                      uint64_t bit = 1ull << (u & 63);
+
+                      if ((work->visited[u >> 6] & bit) == 0
+                          && (work->next[u >> 6].load(std::memory_order_relaxed) & bit) == 0)
+                        {
+                          work->next[u >> 6].fetch_or(bit, std::memory_order_relaxed);
+                        }
+                    }
+                }
+              break;
+
+            case SearchPhase_BottomUp:
+              {
+                uint64_t reached = 0;
+                uint64_t todo = ~work->visited[w] & word_mask(w, vertex_count);
+
+                for (; todo != 0; todo &= todo - 1)
+                  {
+                    uint32_t b = __builtin_ctzll(todo);
+
+                    graph->neighbours(w * 64 + b, true, adjacent.data());
+                    for (uint32_t s = 0; s < graph->degree(); s++)
+                      {
+                        uint64_t u = adjacent[s];
+
+                        if (work->frontier[u >> 6] & (1ull << (u & 63)))
+                          {
+                            reached |= 1ull << b;
+                            break;
+                          }
+                      }
+                  }
+                work->next[w].store(reached, std::memory_order_relaxed);
+              }
+              break;
+
+            case SearchPhase_Merge:
+              {
+                uint64_t added = work->next[w].load(std::memory_order_relaxed)
+                                 & ~work->visited[w];
+
+                work->next[w].store(0, std::memory_order_relaxed);
+                work->visited[w] |= added;
+                work->frontier[w] = added;
+                work->found += __builtin_popcountll(added);
+                for (; added != 0; added &= added - 1)
+                  {
+                    work->distances[w * 64 + __builtin_ctzll(added)] = work->level;
+                  }
+              }
+              break;
+            }
+        }
+    }
+}
+
+CayleyGraph::CayleyGraph()
+{
+  clear();
+}
+
+CayleyGraph::~CayleyGraph()
+{
+}
+
+void
+CayleyGraph::clear(void)
+{
+  element_order = 0;
+  vertex_count = 0;
+  group = NULL;
+  group_values = NULL;
+  generators.clear();
+  inverses.clear();
+  place_values.clear();
+  distances.clear();
+  level_sizes.clear();
+}
+
+GrpErr_t
+CayleyGraph::set_generators(uint32_t order,
+                            const std::vector<GroupElement> &graph_generators)
+{
+  for (uint32_t idx = 0; idx < graph_generators.size(); idx++)
+    {
+      GraphStep forward;
+      GraphStep back;
+
+      if (graph_generators[idx].get_order() != order)
+        {
+          return GrpErr_OrderMismatch;
+        }
+      if (group != NULL && !group->contains(graph_generators[idx]))
+        {
+          return GrpErr_IncompatibleGroupElement;
+        }
+      forward.value = graph_generators[idx].get_element();
+      invert_element_value(forward.value, back.value);
+      forward.first = order;
+      forward.last = 0;
+      for (uint32_t i = 0; i < order; i++)
+        {
+          if (forward.value[i] != static_cast<char>('0' + i))
+            {
+              forward.first = std::min(forward.first, i);
+              forward.last = i + 1;
+            }
+        }
+      // The identity moves nothing and so changes no digits
+      if (forward.first > forward.last)
+        {
+          forward.first = 0;
+        }
+      back.first = forward.first;
+      back.last = forward.last;
+      generators.push_back(forward);
+      inverses.push_back(back);
+    }
+
+  // place_values[i] = (order - 1 - i)!, the weight of Lehmer digit i
+  place_values.assign(order, 1);
+  for (uint32_t i = order - 1; i-- > 0; )
+    {
+      place_values[i] = place_values[i + 1] * (order - 1 - i);
+    }
+  return GrpErr_OK;
+}
+
+GrpErr_t
+CayleyGraph::generate_Sn(uint32_t order,
+                         const std::vector<GroupElement> &graph_generators)
+{
+  clear();
+
+  if (order == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  if (order > max_graph_order)
+    {
+      return GrpErr_ElementOverflow;
+    }
+
+  GrpErr_t result = set_generators(order, graph_generators);
+
+  if (result != GrpErr_OK)
+    {
+      clear();
+      return result;
+    }
+  element_order = order;
+  vertex_count = permutation_count(order);
+  return GrpErr_OK;
+}
+
+GrpErr_t
+CayleyGraph::generate(Group &G,
+                      const std::vector<GroupElement> &graph_generators)
+{
+  clear();
+
+  if (G.size() == 0)
+    {
+      return GrpErr_ElementValueNull;
+    }
+
+  group = &G;
+
+  GrpErr_t result = set_generators(G.get_element_order(), graph_generators);
+
+  if (result != GrpErr_OK)
+    {
+      clear();
+      return result;
+    }
+  element_order = G.get_element_order();
+  vertex_count = G.size();
+  // Builds the index so the workers only read it
+  group_values = G.get_packed_values();
+  return GrpErr_OK;
+}
+
+uint64_t
+CayleyGraph::size(void) const
+{
+  return vertex_count;
+}
+
+uint32_t
+CayleyGraph::get_element_order(void) const
+{
+  return element_order;
+}
+
+uint64_t
+CayleyGraph::identity_vertex(void) const
+{
+  if (group == NULL)
+    {
+      return 0;
+    }
+
+  std::string identity(element_order, '0');
+  uint32_t identity_index = 0;
+
+  for (uint32_t i = 0; i < element_order; i++)
+    {
+      identity[i] += i;
+    }
+  group->find_value(identity.data(), identity_index);
+  return identity_index;
+}
+
+void
+CayleyGraph::vertex_value(uint64_t vertex, char *value) const
+{
+  if (group == NULL)
+    {
+      unrank_element_value(element_order, vertex, value);
+    }
+  else
+    {
+      memcpy(value, group_values + vertex * element_order, element_order);
+    }
+}
+
+uint32_t
+CayleyGraph::degree(void) const
+{
+  return generators.size();
+}
+
+uint64_t
+CayleyGraph::step(const char *value, const GraphStep &generator) const
+{
+  char product[max_order];
+  uint32_t product_index = 0;
+
+  for (uint32_t i = 0; i < element_order; i++)
+    {
+      product[i] = value[generator.value[i] - '0'];
+    }
+  group->find_value(product, product_index);
+  return product_index;
+}
+
+uint64_t
+CayleyGraph::neighbour(uint64_t vertex, uint32_t generator) const
+{
+  if (generator >= generators.size())
+    {
+      throw GroupError(GrpErr_IndexOutOfBounds);
+    }
+
+  std::vector<uint64_t> adjacent(generators.size());
+
+  neighbours(vertex, false, adjacent.data());
+  return adjacent[generator];
+}
+
+void
+CayleyGraph::neighbours(uint64_t vertex, bool parents, uint64_t *adjacent) const
+{
+  const std::vector<GraphStep> &steps = parents ? inverses : generators;
+  char value[max_order];
+
+  if (group != NULL)
+    {
+      vertex_value(vertex, value);
+      for (uint32_t s = 0; s < steps.size(); s++)
+        {
+          adjacent[s] = step(value, steps[s]);
+        }
+      return;
+    }
+
+  // Unrank keeping the Lehmer digits and the values before each
+  // position.  A product x * s only differs from x where s moves, so its
+  // rank is the vertex's corrected by the digits in that range.  12!
+  // fits 32 bits, which keeps the divisions short.
+  uint32_t used_before[max_order];
+  int32_t digits[max_order];
+  char remaining[max_order];
+  uint32_t rank = vertex;
+  uint32_t used = 0;
+
+  for (uint32_t i = element_order; i-- > 0; )
+    {
+      digits[i] = rank % (element_order - i);
+      rank /= (element_order - i);
+      remaining[i] = '0' + i;
+    }
+  for (uint32_t i = 0; i < element_order; i++)
+    {
+      uint32_t left = element_order - i;
+
+      value[i] = remaining[digits[i]];
+      memmove(remaining + digits[i], remaining + digits[i] + 1, left - digits[i] - 1);
+      used_before[i] = used;
+      used |= 1u << (value[i] - '0');
+    }
+
+  for (uint32_t s = 0; s < steps.size(); s++)
+    {
+      const GraphStep &generator = steps[s];
+      uint64_t product_rank = vertex;
+
+      used = generator.first < element_order ? used_before[generator.first] : 0;
+      for (uint32_t i = generator.first; i < generator.last; i++)
+        {
+          uint32_t digit = value[generator.value[i] - '0'] - '0';
+          int32_t lehmer = digit - __builtin_popcount(used & ((1u << digit) - 1));
+
+          product_rank += static_cast<int64_t>(lehmer - digits[i]) * place_values[i];
+          used |= 1u << digit;
+        }
+      adjacent[s] = product_rank;
+    }
+}
+
+GrpErr_t
+CayleyGraph::word_lengths(uint32_t threads)
+{
+  if (vertex_count == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  if (threads == 0)
+    {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+  uint64_t words = (vertex_count + 63) / 64;
+  std::vector<uint64_t> visited(words, 0);
+  std::vector<uint64_t> frontier(words, 0);
+  std::vector<std::atomic<uint64_t> > next(words);
+  uint64_t start = identity_vertex();
+  uint64_t reached_count = 1;
+  uint64_t frontier_count = 1;
+
+  for (uint64_t w = 0; w < words; w++)
+    {
+      next[w].store(0, std::memory_order_relaxed);
+    }
+  distances.assign(vertex_count, unreached_vertex);
+  level_sizes.assign(1, 1);
+  distances[start] = 0;
+  visited[start >> 6] |= 1ull << (start & 63);
+  frontier[start >> 6] |= 1ull << (start & 63);
+
+  while (frontier_count != 0 && reached_count < vertex_count)
+    {
+      if (level_sizes.size() >= unreached_vertex)
+        {
+          return GrpErr_ElementOverflow;
+        }
+
+      uint64_t unreached_count = vertex_count - reached_count;
+      SearchPhase_t phases[2];
+
+      // Once the frontier outnumbers the unreached vertices it is cheaper
+      // for each of those to look for a parent in the frontier than for
+      // the frontier to push to all its neighbours
+      phases[0] = frontier_count > unreached_count
+                  ? SearchPhase_BottomUp : SearchPhase_TopDown;
+      phases[1] = SearchPhase_Merge;
+
+      std::vector<SearchWorker> work(threads);
+
+      for (uint32_t p = 0; p < 2; p++)
+        {
+          std::atomic<uint64_t> next_chunk(0);
+          std::vector<std::thread> workers;
+
+          for (uint32_t t = 0; t < threads; t++)
+            {
+              work[t].phase = phases[p];
+              work[t].graph = this;
+              work[t].words = words;
+              work[t].next_chunk = &next_chunk;
+              work[t].visited = visited.data();
+              work[t].frontier = frontier.data();
+              work[t].next = next.data();
+              work[t].distances = distances.data();
+              work[t].level = level_sizes.size();
+              work[t].found = 0;
+            }
+          if (threads == 1)
+            {
+              search_worker(&work[0]);
+              continue;
+            }
+          for (uint32_t t = 0; t < threads; t++)
+            {
+              workers.push_back(std::thread(search_worker, &work[t]));
+            }
+          for (uint32_t t = 0; t < threads; t++)
+            {
+              workers[t].join();
+            }
+        }
+
+      frontier_count = 0;
+      for (uint32_t t = 0; t < threads; t++)
+        {
+          frontier_count += work[t].found;
+        }
+      if (frontier_count != 0)
+        {
+          level_sizes.push_back(frontier_count);
+          reached_count += frontier_count;
+        }
+    }
+  return GrpErr_OK;
+}
+
+const std::vector<uint16_t> &
+CayleyGraph::get_distances(void) const
+{
+  return distances;
+}
+
+const std::vector<uint64_t> &
+CayleyGraph::get_level_sizes(void) const
+{
+  return level_sizes;
+}
+
+uint32_t
+CayleyGraph::diameter(void) const
+{
+  return level_sizes.empty() ? 0 : level_sizes.size() - 1;
+}
+
+uint64_t
+CayleyGraph::reached(void) const
+{
+  uint64_t total = 0;
+
+  for (uint32_t d = 0; d < level_sizes.size(); d++)
+    {
+      total += level_sizes[d];
+    }
+  return total;
+}
@@ -0,0 +1,119 @@
+/******************************************************************************/
+/*                                                                            */
+/*  CayleyGraph.h Word lengths over the Cayley graph of a generating set      */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef CAYLEY_GRAPH_H__
+#define CAYLEY_GRAPH_H__
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+
+// Largest n for which all of Sn can be searched, 12! vertices
+const uint32_t max_graph_order = 12;
+
+// Distance of a vertex the generators cannot reach
+const uint16_t unreached_vertex = 0xFFFF;
+
+// The Cayley graph of a generating set: x is joined to x * s for each
+// generator s.  The edges are never stored, a vertex's neighbours are
+// found by multiplying and ranking when they are needed.  The vertices
+// are either the Lehmer ranks of all of Sn, so no Group is materialized,
+// or the element indices of a Group.
+class CayleyGraph
+{
+ public:
+  CayleyGraph();
+  ~CayleyGraph();
+
+  // All of Sn for order <= max_graph_order
+  GrpErr_t generate_Sn(uint32_t order,
+                       const std::vector<GroupElement> &graph_generators);
+  // The elements of G, which must not change while the graph is used
+  GrpErr_t generate(Group &G,
+                    const std::vector<GroupElement> &graph_generators);
+  void clear(void);
+
+  uint64_t size(void) const;
+  uint32_t get_element_order(void) const;
+  uint64_t identity_vertex(void) const;
+  // value holds get_element_order() characters
+  void vertex_value(uint64_t vertex, char *value) const;
+  uint32_t degree(void) const;
+  // The vertex joined to vertex by the generator, vertex * generator
+  uint64_t neighbour(uint64_t vertex, uint32_t generator) const;
+  // All degree() of them, or with parents the vertices joined to this
+  // one, vertex * generator^-1
+  void neighbours(uint64_t vertex, bool parents, uint64_t *adjacent) const;
+
+  // Breadth first search from the identity, a level at a time over
+  // bitset frontiers.  Each level is expanded on the worker threads,
+  // from the frontier outwards while it is small and from the unreached
+  // vertices inwards once it is large.  threads == 0 uses one worker per
+  // hardware thread.
+  GrpErr_t word_lengths(uint32_t threads = 0);
+
+  // The word length of each vertex, unreached_vertex when the
+  // generators do not generate the whole group
+  const std::vector<uint16_t> &get_distances(void) const;
+  // level_sizes[d] is the number of elements of word length d
+  const std::vector<uint64_t> &get_level_sizes(void) const;
+  uint32_t diameter(void) const;
+  uint64_t reached(void) const;
+
+ private:
+  GrpErr_t set_generators(uint32_t order,
+                          const std::vector<GroupElement> &graph_generators);
+
+  uint32_t element_order;
+  uint64_t vertex_count;
+  // Null when the vertices are the ranks of Sn
+  Group *group;
+  const char *group_values;
+  // A generator only moves the positions first to last, so on Sn
+  // only those Lehmer digits of a product need recomputing
+  typedef struct
+  {
+    std::string value;
+    uint32_t first;
+    uint32_t last;
+  } GraphStep;
+
+  uint64_t step(const char *value, const GraphStep &generator) const;
+
+  std::vector<GraphStep> generators;
+  std::vector<GraphStep> inverses;
+  std::vector<uint64_t> place_values;
+
+  std::vector<uint16_t> distances;
+  std::vector<uint64_t> level_sizes;
+};
+
+#endif // CAYLEY_GRAPH_H__
@@ -0,0 +1,297 @@
+/******************************************************************************/
+/*                                                                            */
+/*  CayleyTable.cpp: Group multiplication tables with checkpoints             */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+#include "CayleyTable.h"
+#include "ElementBatch.h"
+
+// The checkpoint layout, integers in host byte order:
+//   char     magic[8]
+//   uint32_t size
+//   uint64_t fingerprint
+//   uint32_t rows            rewritten after each append
+//   uint32_t products[rows * size]
+// Rows past the count, from a save cut short, are ignored and
+// overwritten by the next one.
+const char checkpoint_magic[8] = {'C', 'A', 'Y', 'L', 'E', 'Y', '0', '2'};
+const std::streamoff checkpoint_rows_offset = sizeof(checkpoint_magic)
+  + sizeof(uint32_t) + sizeof(uint64_t);
+const std::streamoff checkpoint_header = checkpoint_rows_offset + sizeof(uint32_t);
+
+// FNV-1a over the element values
+static uint64_t
+group_fingerprint(Group &G)
+{
+  const char *values = G.get_packed_values();
+  size_t length = static_cast<size_t>(G.size()) * G.get_element_order();
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (size_t idx = 0; idx < length; idx++)
+    {
+      hash ^= static_cast<unsigned char>(values[idx]);
+      hash *= 1099511628211ULL;
+    }
+  return hash ^ G.get_element_order();
+}
+
+CayleyTable::CayleyTable()
+{
+  group_size = 0;
+  rows_done = 0;
+  rows_saved = 0;
+  fingerprint = 0;
+}
+
+CayleyTable::~CayleyTable()
+{
+}
+
+void
+CayleyTable::clear(void)
+{
+  group_size = 0;
+  rows_done = 0;
+  rows_saved = 0;
+  fingerprint = 0;
+  table.clear();
+}
+
+GrpErr_t
+CayleyTable::build_row(Group &G, uint32_t row)
+{
+  const uint32_t block = 4096;
+  uint32_t order = G.get_element_order();
+  const char *values = G.get_packed_values();
+  std::string lhs(values + static_cast<size_t>(row) * order, order);
+  uint32_t *products = &table[static_cast<size_t>(row) * group_size];
+  std::vector<char> packed(static_cast<size_t>(block) * order);
+
+  // The row is lhs times every element, a block of columns at a time
+  for (uint32_t first = 0; first < group_size; first += block)
+    {
+      uint32_t count = std::min(block, group_size - first);
+
+      multiply_packed_values(values + static_cast<size_t>(first) * order,
+                             count, order, lhs, GrpElDirection_left,
+                             packed.data());
+      for (uint32_t column = 0; column < count; column++)
+        {
+          if (!G.find_value(&packed[static_cast<size_t>(column) * order],
+                            products[first + column]))
+            {
+              // Not closed, so not a group
+              return GrpErr_MissingElement;
+            }
+        }
+    }
+  return GrpErr_OK;
+}
+
+GrpErr_t
+CayleyTable::generate(Group &G)
+{
+  return generate(G, "", 0, false);
+}
+
+GrpErr_t
+CayleyTable::generate(Group &G, const std::string &checkpoint_file,
+                      uint32_t checkpoint_seconds, bool resume)
+{
+  GrpErr_t rVal = GrpErr_OK;
+
+  clear();
+  group_size = G.size();
+  if (group_size == 0)
+    {
+      return GrpErr_ElementValueNull;
+    }
+  if (group_size > max_table_size)
+    {
+      return GrpErr_ElementOverflow;
+    }
+  fingerprint = group_fingerprint(G);
+  table.assign(static_cast<size_t>(group_size) * group_size, 0);
+
+  if (resume && !checkpoint_file.empty())
+    {
+      if ((rVal = read_checkpoint(checkpoint_file)) != GrpErr_OK)
+        {
+          return rVal;
+        }
+    }
+
+  time_t last_checkpoint = time(NULL);
+
+  while (rows_done < group_size)
+    {
+      if ((rVal = build_row(G, rows_done)) != GrpErr_OK)
+        {
+          return rVal;
+        }
+      rows_done++;
+
+      if (!checkpoint_file.empty()
+          && time(NULL) - last_checkpoint >= static_cast<time_t>(checkpoint_seconds))
+        {
+          if ((rVal = write_checkpoint(checkpoint_file)) != GrpErr_OK)
+            {
+              return rVal;
+            }
+          last_checkpoint = time(NULL);
+        }
+    }
+
+  if (!checkpoint_file.empty())
+    {
+      remove(checkpoint_file.c_str());
+    }
+  return rVal;
+}
+
+// Only the rows finished since the last save are appended, so each row
+// is written once.  The row count in the header is rewritten after the
+// rows, so a kill part way through leaves the previous count in force.
+GrpErr_t
+CayleyTable::write_checkpoint(const std::string &checkpoint_file)
+{
+  const std::streamoff row_bytes = static_cast<std::streamoff>(group_size)
+    * sizeof(uint32_t);
+
+  if (rows_saved == 0)
+    {
+      // A fresh file holding the header alone
+      std::ofstream header(checkpoint_file.c_str(), std::ios::binary | std::ios::trunc);
+      uint32_t no_rows = 0;
+
+      header.write(checkpoint_magic, sizeof(checkpoint_magic));
+      header.write(reinterpret_cast<const char *>(&group_size), sizeof(group_size));
+      header.write(reinterpret_cast<const char *>(&fingerprint), sizeof(fingerprint));
+      header.write(reinterpret_cast<const char *>(&no_rows), sizeof(no_rows));
+      header.close();
+      if (!header)
+        {
+          return GrpErr_FileAccess;
+        }
+    }
+
+  std::fstream out(checkpoint_file.c_str(),
+                   std::ios::binary | std::ios::in | std::ios::out);
+
+  out.seekp(checkpoint_header + rows_saved * row_bytes);
+  out.write(reinterpret_cast<const char *>(&table[static_cast<size_t>(rows_saved)
+                                                  * group_size]),
+            (rows_done - rows_saved) * row_bytes);
+  out.flush();
+  out.seekp(checkpoint_rows_offset);
+  out.write(reinterpret_cast<const char *>(&rows_done), sizeof(rows_done));
+  out.close();
+
+  if (!out)
+    {
+      return GrpErr_FileAccess;
+    }
+  rows_saved = rows_done;
+  return GrpErr_OK;
+}
+
+GrpErr_t
+CayleyTable::read_checkpoint(const std::string &checkpoint_file)
+{
+  std::ifstream in(checkpoint_file.c_str(), std::ios::binary);
+  char magic[sizeof(checkpoint_magic)];
+  uint32_t saved_size = 0;
+  uint64_t saved_fingerprint = 0;
+  uint32_t saved_rows = 0;
+
+  if (!in)
+    {
+      // Nothing saved yet, start from the first row
+      return GrpErr_OK;
+    }
+
+  in.read(magic, sizeof(magic));
+  in.read(reinterpret_cast<char *>(&saved_size), sizeof(saved_size));
+  in.read(reinterpret_cast<char *>(&saved_fingerprint), sizeof(saved_fingerprint));
+  in.read(reinterpret_cast<char *>(&saved_rows), sizeof(saved_rows));
+  if (!in)
+    {
+      return GrpErr_FileAccess;
+    }
+  if (memcmp(magic, checkpoint_magic, sizeof(magic)) != 0
+      || saved_size != group_size || saved_fingerprint != fingerprint
+      || saved_rows > group_size)
+    {
+      return GrpErr_CheckpointMismatch;
+    }
+
+  in.read(reinterpret_cast<char *>(table.data()),
+          static_cast<std::streamsize>(saved_rows) * group_size * sizeof(uint32_t));
+  if (!in)
+    {
+      return GrpErr_FileAccess;
+    }
+  rows_done = saved_rows;
+  rows_saved = saved_rows;
+  return GrpErr_OK;
+}
+
+uint32_t
+CayleyTable::size(void) const
+{
+  return group_size;
+}
+
+uint32_t
+CayleyTable::product(uint32_t row, uint32_t column) const
+{
+  if (row >= rows_done || column >= group_size)
+    {
+      GroupError e(GrpErr_IndexOutOfBounds);
+      throw e;
+    }
+  return table[static_cast<size_t>(row) * group_size + column];
+}
+
+const uint32_t *
+CayleyTable::get_row(uint32_t row) const
+{
+  if (row >= rows_done)
+    {
+      GroupError e(GrpErr_IndexOutOfBounds);
+      throw e;
+    }
+  return &table[static_cast<size_t>(row) * group_size];
+}
@@ -0,0 +1,81 @@
+/******************************************************************************/
+/*                                                                            */
+/*  CayleyTable.h Definitions for group multiplication tables                 */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef CAYLEY_TABLE_H__
+#define CAYLEY_TABLE_H__
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "GroupError.h"
+#include "Group.h"
+
+// The largest group whose table is built: the whole table is held in
+// memory, 4 * size * size bytes, which is 16 GB at this size.  S8 fits,
+// S9 and beyond do not.
+const uint32_t max_table_size = 1 << 16;
+
+// The multiplication table of a group by element index:
+// product(row, column) is the index of element row * element column.
+class CayleyTable
+{
+ public:
+  CayleyTable();
+  ~CayleyTable();
+
+  GrpErr_t generate(Group &G);
+
+  // As above, appending the rows finished since the last save to
+  // checkpoint_file whenever checkpoint_seconds have passed.  With resume
+  // the rows already in the checkpoint are loaded and only the rest are
+  // built.  The checkpoint is removed once the table is complete.
+  // GrpErr_ElementOverflow for groups above max_table_size.
+  GrpErr_t generate(Group &G, const std::string &checkpoint_file,
+                    uint32_t checkpoint_seconds, bool resume);
+  void clear(void);
+
+  // The number of elements, i.e. rows and columns
+  uint32_t size(void) const;
+  uint32_t product(uint32_t row, uint32_t column) const;
+  const uint32_t *get_row(uint32_t row) const;
+
+ private:
+  GrpErr_t write_checkpoint(const std::string &checkpoint_file);
+  GrpErr_t read_checkpoint(const std::string &checkpoint_file);
+  GrpErr_t build_row(Group &G, uint32_t row);
+
+  uint32_t group_size;
+  uint32_t rows_done;
+  // Rows already in the checkpoint file
+  uint32_t rows_saved;
+  // Identifies the group the rows belong to
+  uint64_t fingerprint;
+  std::vector<uint32_t> table;
+};
+
+#endif // CAYLEY_TABLE_H__
@@ -0,0 +1,257 @@
+/******************************************************************************/
+/*                                                                            */
+/*  CycleNotation.cpp: Reading and writing elements as disjoint cycles        */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "CycleNotation.h"
+
+static inline bool
+is_separator(char c)
+{
+  return c == ' ' || c == '\t' || c == ',' || c == ';'
+    || c == '\r' || c == '\n';
+}
+
+static inline bool
+is_digit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+GrpErr_t
+parse_cycle_value(const char *text, size_t length, uint32_t order,
+                  char *element_value)
+{
+  if (order == 0 || order > max_order)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+
+  uint32_t seen = 0;
+  bool in_cycle = false;
+  uint32_t first = 0;
+  uint32_t previous = 0;
+  uint32_t points = 0;
+
+  for (uint32_t i = 0; i < order; i++)
+    {
+      element_value[i] = i + '0';
+    }
+
+  for (size_t pos = 0; pos < length; )
+    {
+      char c = text[pos];
+
+      if (is_separator(c))
+        {
+          pos++;
+        }
+      else if (c == '(')
+        {
+          if (in_cycle)
+            {
+              return GrpErr_ParseError;
+            }
+          in_cycle = true;
+          points = 0;
+          pos++;
+        }
+      else if (c == ')')
+        {
+          if (!in_cycle)
+            {
+              return GrpErr_ParseError;
+            }
+          // Close the cycle back to its first point
+          if (points > 0)
+            {
+              element_value[previous] = first + '0';
+            }
+          in_cycle = false;
+          pos++;
+        }
+      else if (is_digit(c) && in_cycle)
+        {
+          uint32_t point = 0;
+
+          for (; pos < length && is_digit(text[pos]); pos++)
+            {
+              point = point * 10 + (text[pos] - '0');
+              if (point >= order)
+                {
+                  return GrpErr_ElementValueOutOfRange;
+                }
+            }
+          if (seen & (1u << point))
+            {
+              return GrpErr_ElementValueDuplicated;
+            }
+          seen |= 1u << point;
+
+          if (points == 0)
+            {
+              first = point;
+            }
+          else
+            {
+              element_value[previous] = point + '0';
+            }
+          previous = point;
+          points++;
+        }
+      else
+        {
+          return GrpErr_ParseError;
+        }
+    }
+  return in_cycle ? GrpErr_ParseError : GrpErr_OK;
+}
+
+uint32_t
+cycle_text_order(const char *text, size_t length)
+{
+  uint32_t order = 0;
+
+  for (size_t pos = 0; pos < length; )
+    {
+      if (!is_digit(text[pos]))
+        {
+          pos++;
+          continue;
+        }
+
+      uint32_t point = 0;
+
+      for (; pos < length && is_digit(text[pos]) && point <= max_order; pos++)
+        {
+          point = point * 10 + (text[pos] - '0');
+        }
+      if (point + 1 > order)
+        {
+          order = point + 1;
+        }
+    }
+  return order;
+}
+
+// Two digit points at most, so the number is written by hand
+static inline char *
+put_point(char *out, uint32_t point)
+{
+  if (point >= 10)
+    {
+      *out++ = '0' + point / 10;
+    }
+  *out++ = '0' + point % 10;
+  return out;
+}
+
+size_t
+format_cycle_value(const char *element_value, uint32_t order, char *buffer)
+{
+  uint32_t seen = 0;
+  char *out = buffer;
+
+  for (uint32_t start = 0; start < order; start++)
+    {
+      uint32_t next = element_value[start] - '0';
+
+      if ((seen & (1u << start)) || next == start)
+        {
+          continue;
+        }
+
+      *out++ = '(';
+      out = put_point(out, start);
+      seen |= 1u << start;
+      for (; next != start; next = element_value[next] - '0')
+        {
+          *out++ = ' ';
+          out = put_point(out, next);
+          seen |= 1u << next;
+        }
+      *out++ = ')';
+    }
+  if (out == buffer)
+    {
+      *out++ = '(';
+      *out++ = ')';
+    }
+  *out = '\0';
+  return out - buffer;
+}
+
+GrpErr_t
+parse_element_text(const std::string &text, uint32_t order,
+                   GroupElement &element)
+{
+  // "" is the identity, like "()", so it goes with the cycles
+  if (!text.empty() && (text.find('(') == std::string::npos))
+    {
+      // A digit string, checked by the element itself, which refuses one
+      // longer than max_order before looking at its digits
+      GroupElement parsed;
+
+      if (order != 0 && order != text.size())
+        {
+          return GrpErr_OrderMismatch;
+        }
+
+      GrpErr_t rVal = parsed.try_set_element(text);
+
+      if (rVal == GrpErr_OK)
+        {
+          element = parsed;
+        }
+      return rVal;
+    }
+
+  if (order == 0)
+    {
+      order = cycle_text_order(text.data(), text.size());
+    }
+
+  char value[max_order];
+  GrpErr_t rVal = parse_cycle_value(text.data(), text.size(), order, value);
+
+  if (rVal == GrpErr_OK)
+    {
+      element.set_order(order);
+      element.set_element(std::string(value, order));
+    }
+  return rVal;
+}
+
+std::string
+cycle_notation(const GroupElement &element)
+{
+  std::string value = element.get_element();
+  char buffer[max_cycle_text];
+  size_t length = format_cycle_value(value.data(), value.size(), buffer);
+
+  return std::string(buffer, length);
+}
@@ -0,0 +1,71 @@
+/******************************************************************************/
+/*                                                                            */
+/*  CycleNotation.h Reading and writing elements as disjoint cycles           */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef CYCLE_NOTATION_H__
+#define CYCLE_NOTATION_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+
+// Elements written as disjoint cycles, "(0 3 2)(1 4)", where each point
+// goes to the next in its cycle and the points not written are fixed.
+// The points are decimal so degrees past ten stay unambiguous.  Spaces,
+// tabs, commas and semicolons all separate points, so "(0,3,2) (1,4)"
+// is the same element, and "()" or "" is the identity.
+
+// Enough for any element up to max_order, with the terminating nul
+const size_t max_cycle_text = 64;
+
+// Fills in the order characters of element_value from the text.  Nothing
+// is allocated.  A point at or past order is GrpErr_ElementValueOutOfRange,
+// a point in two places GrpErr_ElementValueDuplicated and anything else
+// that is not cycles GrpErr_ParseError.
+GrpErr_t parse_cycle_value(const char *text, size_t length, uint32_t order,
+                           char *element_value);
+
+// One more than the largest point in the text, the least order it fits
+uint32_t cycle_text_order(const char *text, size_t length);
+
+// Writes the cycles of element_value, smallest point first in each, into
+// buffer, which holds max_cycle_text characters.  Returns the length.
+size_t format_cycle_value(const char *element_value, uint32_t order,
+                          char *buffer);
+
+// An element from either cycle notation or a digit string such as 3021.
+// With an order of 0 a digit string gives its own order and cycles take
+// the least order they fit, so "" and "()" need an order to be the
+// identity.
+GrpErr_t parse_element_text(const std::string &text, uint32_t order,
+                            GroupElement &element);
+
+std::string cycle_notation(const GroupElement &element);
+
+#endif // CYCLE_NOTATION_H__
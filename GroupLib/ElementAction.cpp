@@ -0,0 +1,373 @@
+/******************************************************************************/
+/*                                                                            */
+/*  ElementAction.cpp: Permuting data buffers by group elements               */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "ElementAction.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ELEMENT_ACTION_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
+// Where each output item comes from: source[g[i]] = i
+static GrpErr_t
+item_sources(const GroupElement &g, size_t items, size_t item_size,
+             std::vector<uint8_t> &source)
+{
+  std::string value = g.get_element();
+  uint32_t order = value.size();
+
+  if (order == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  if (item_size == 0 || items % order != 0)
+    {
+      return GrpErr_OrderMismatch;
+    }
+
+  source.resize(order);
+  for (uint32_t i = 0; i < order; i++)
+    {
+      source[value[i] - '0'] = i;
+    }
+  return GrpErr_OK;
+}
+
+template <typename T>
+static void
+gather_items(const T *in, T *out, size_t blocks, uint32_t order,
+             const uint8_t *source)
+{
+  for (size_t block = 0; block < blocks; block++)
+    {
+      for (uint32_t j = 0; j < order; j++)
+        {
+          out[j] = in[source[j]];
+        }
+      in += order;
+      out += order;
+    }
+}
+
+static void
+gather_bytes(const char *in, char *out, size_t blocks, uint32_t order,
+             size_t item_size, const uint8_t *source)
+{
+  size_t block_bytes = order * item_size;
+
+  for (size_t block = 0; block < blocks; block++)
+    {
+      for (uint32_t j = 0; j < order; j++)
+        {
+          memcpy(out + j * item_size, in + source[j] * item_size, item_size);
+        }
+      in += block_bytes;
+      out += block_bytes;
+    }
+}
+
+#ifdef ELEMENT_ACTION_SSSE3
+
+// Shuffles whole blocks in one or two registers and returns how many
+// blocks were done; the last few are left for the word loops because the
+// loads run past the block.  The bytes past the block are stored back
+// unchanged, so in and out may be the same buffer.
+__attribute__((target("ssse3")))
+static size_t
+shuffle_blocks_ssse3(const char *in, char *out, size_t blocks,
+                     uint32_t order, size_t item_size, const uint8_t *source)
+{
+  const uint8_t zero = 0x80;
+  size_t block_bytes = order * item_size;
+  size_t bytes = blocks * block_bytes;
+  size_t pos = 0;
+  uint8_t from[32];
+
+  if (block_bytes > 32)
+    {
+      return 0;
+    }
+  for (size_t j = 0; j < block_bytes; j++)
+    {
+      from[j] = source[j / item_size] * item_size + j % item_size;
+    }
+
+  if (block_bytes <= 16)
+    {
+      // As many whole blocks as fit in the register
+      size_t whole = 16 / block_bytes;
+      size_t step = whole * block_bytes;
+      uint8_t lanes[16];
+
+      for (size_t lane = 0; lane < 16; lane++)
+        {
+          lanes[lane] = (lane < step)
+            ? (lane / block_bytes) * block_bytes + from[lane % block_bytes]
+            : lane;
+        }
+
+      __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes));
+
+      for (; pos + 16 <= bytes; pos += step)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + pos));
+
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos),
+                           _mm_shuffle_epi8(v, mask));
+        }
+      return pos / block_bytes;
+    }
+
+  // One block across two registers: each output half takes its bytes
+  // from the low and high source halves and the two are or'ed together
+  uint8_t lanes[4][16];
+
+  memset(lanes, zero, sizeof(lanes));
+  for (size_t j = 0; j < 32; j++)
+    {
+      uint8_t byte = (j < block_bytes) ? from[j] : j;
+
+      lanes[(j / 16) * 2 + byte / 16][j % 16] = byte % 16;
+    }
+
+  __m128i low_low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes[0]));
+  __m128i low_high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes[1]));
+  __m128i high_low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes[2]));
+  __m128i high_high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes[3]));
+
+  for (; pos + 32 <= bytes; pos += block_bytes)
+    {
+      __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + pos));
+      __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + pos + 16));
+
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos),
+                       _mm_or_si128(_mm_shuffle_epi8(low, low_low),
+                                    _mm_shuffle_epi8(high, low_high)));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos + 16),
+                       _mm_or_si128(_mm_shuffle_epi8(low, high_low),
+                                    _mm_shuffle_epi8(high, high_high)));
+    }
+  return pos / block_bytes;
+}
+
+#endif // ELEMENT_ACTION_SSSE3
+
+GrpErr_t
+apply_element(const GroupElement &g, const void *in, void *out,
+              size_t items, size_t item_size)
+{
+  std::vector<uint8_t> source;
+  GrpErr_t rVal = item_sources(g, items, item_size, source);
+
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+
+  uint32_t order = source.size();
+  size_t blocks = items / order;
+  const char *from = static_cast<const char *>(in);
+  char *to = static_cast<char *>(out);
+
+#ifdef ELEMENT_ACTION_SSSE3
+  static const bool have_ssse3 = __builtin_cpu_supports("ssse3");
+
+  if (have_ssse3 && item_size <= 8)
+    {
+      size_t done = shuffle_blocks_ssse3(from, to, blocks, order, item_size,
+                                         source.data());
+      size_t offset = done * order * item_size;
+
+      from += offset;
+      to += offset;
+      blocks -= done;
+    }
+#endif
+
+  switch (item_size)
+    {
+    case 1:
+      gather_items(reinterpret_cast<const uint8_t *>(from),
+                   reinterpret_cast<uint8_t *>(to), blocks, order,
+                   source.data());
+      break;
+    case 2:
+      gather_items(reinterpret_cast<const uint16_t *>(from),
+                   reinterpret_cast<uint16_t *>(to), blocks, order,
+                   source.data());
+      break;
+    case 4:
+      gather_items(reinterpret_cast<const uint32_t *>(from),
+                   reinterpret_cast<uint32_t *>(to), blocks, order,
+                   source.data());
+      break;
+    case 8:
+      gather_items(reinterpret_cast<const uint64_t *>(from),
+                   reinterpret_cast<uint64_t *>(to), blocks, order,
+                   source.data());
+      break;
+    default:
+      gather_bytes(from, to, blocks, order, item_size, source.data());
+      break;
+    }
+  return GrpErr_OK;
+}
+
+// Each cycle of g is walked along source, c[m + 1] = source[c[m]], so
+// the moves are c[m] <- c[m + 1] with the first item saved for the last
+template <typename T>
+static void
+rotate_cycles(T *block, size_t blocks, uint32_t order,
+              const std::vector<uint8_t> &cycles,
+              const std::vector<uint8_t> &lengths)
+{
+  for (size_t b = 0; b < blocks; b++)
+    {
+      const uint8_t *cycle = cycles.data();
+
+      for (size_t c = 0; c < lengths.size(); c++)
+        {
+          uint32_t length = lengths[c];
+          T saved = block[cycle[0]];
+
+          for (uint32_t m = 0; m + 1 < length; m++)
+            {
+              block[cycle[m]] = block[cycle[m + 1]];
+            }
+          block[cycle[length - 1]] = saved;
+          cycle += length;
+        }
+      block += order;
+    }
+}
+
+static void
+rotate_cycles_bytes(char *block, size_t blocks, uint32_t order,
+                    size_t item_size, const std::vector<uint8_t> &cycles,
+                    const std::vector<uint8_t> &lengths)
+{
+  std::vector<char> saved(item_size);
+
+  for (size_t b = 0; b < blocks; b++)
+    {
+      const uint8_t *cycle = cycles.data();
+
+      for (size_t c = 0; c < lengths.size(); c++)
+        {
+          uint32_t length = lengths[c];
+
+          memcpy(saved.data(), block + cycle[0] * item_size, item_size);
+          for (uint32_t m = 0; m + 1 < length; m++)
+            {
+              memcpy(block + cycle[m] * item_size,
+                     block + cycle[m + 1] * item_size, item_size);
+            }
+          memcpy(block + cycle[length - 1] * item_size, saved.data(),
+                 item_size);
+          cycle += length;
+        }
+      block += order * item_size;
+    }
+}
+
+GrpErr_t
+apply_element_in_place(const GroupElement &g, void *data,
+                       size_t items, size_t item_size)
+{
+  std::vector<uint8_t> source;
+  GrpErr_t rVal = item_sources(g, items, item_size, source);
+
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+
+  uint32_t order = source.size();
+  size_t blocks = items / order;
+  std::vector<uint8_t> cycles;
+  std::vector<uint8_t> lengths;
+  std::vector<bool> seen(order, false);
+
+  // Fixed points stay where they are
+  for (uint32_t i = 0; i < order; i++)
+    {
+      if (seen[i] || source[i] == i)
+        {
+          continue;
+        }
+
+      uint32_t length = 0;
+
+      for (uint32_t pos = i; !seen[pos]; pos = source[pos])
+        {
+          seen[pos] = true;
+          cycles.push_back(pos);
+          length++;
+        }
+      lengths.push_back(length);
+    }
+
+#ifdef ELEMENT_ACTION_SSSE3
+  static const bool have_ssse3 = __builtin_cpu_supports("ssse3");
+
+  // Blocks that fit in registers are permuted there
+  if (have_ssse3 && item_size <= 8)
+    {
+      size_t done = shuffle_blocks_ssse3(static_cast<char *>(data),
+                                         static_cast<char *>(data), blocks,
+                                         order, item_size, source.data());
+
+      data = static_cast<char *>(data) + done * order * item_size;
+      blocks -= done;
+    }
+#endif
+
+  switch (item_size)
+    {
+    case 1:
+      rotate_cycles(static_cast<uint8_t *>(data), blocks, order, cycles, lengths);
+      break;
+    case 2:
+      rotate_cycles(static_cast<uint16_t *>(data), blocks, order, cycles, lengths);
+      break;
+    case 4:
+      rotate_cycles(static_cast<uint32_t *>(data), blocks, order, cycles, lengths);
+      break;
+    case 8:
+      rotate_cycles(static_cast<uint64_t *>(data), blocks, order, cycles, lengths);
+      break;
+    default:
+      rotate_cycles_bytes(static_cast<char *>(data), blocks, order, item_size,
+                          cycles, lengths);
+      break;
+    }
+  return GrpErr_OK;
+}
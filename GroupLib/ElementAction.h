@@ -0,0 +1,69 @@
+/******************************************************************************/
+/*                                                                            */
+/*  ElementAction.h Permuting data buffers by group elements                  */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef ELEMENT_ACTION_H__
+#define ELEMENT_ACTION_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "GroupElement.h"
+
+// An element g of order n acts on a buffer of items taken n at a time:
+// in each block the item at position i moves to position g[i], so
+// out[g[i]] = in[i].  Applying a * b is applying b and then a.  A buffer
+// of n items is a record reordered once; a matrix of n columns has every
+// row reordered.
+//
+// items must be a multiple of the element's order and in and out must not
+// overlap.  Items of 1, 2, 4 and 8 bytes are moved as words, and blocks
+// of up to 32 bytes are shuffled in registers on x86 with SSSE3.
+GrpErr_t apply_element(const GroupElement &g, const void *in, void *out,
+                       size_t items, size_t item_size);
+
+// The same without a second buffer.  Blocks that fit in registers are
+// shuffled there and the rest have their items moved round the cycles
+// of g.
+GrpErr_t apply_element_in_place(const GroupElement &g, void *data,
+                                size_t items, size_t item_size);
+
+template <typename T>
+GrpErr_t
+apply_element(const GroupElement &g, const T *in, T *out, size_t items)
+{
+  return apply_element(g, static_cast<const void *>(in),
+                       static_cast<void *>(out), items, sizeof(T));
+}
+
+template <typename T>
+GrpErr_t
+apply_element_in_place(const GroupElement &g, T *data, size_t items)
+{
+  return apply_element_in_place(g, static_cast<void *>(data), items,
+                                sizeof(T));
+}
+
+#endif // ELEMENT_ACTION_H__
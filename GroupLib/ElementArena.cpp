@@ -0,0 +1,119 @@
+/******************************************************************************/
+/*                                                                            */
+/*  ElementArena.cpp: Slab storage for group elements                         */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <new>
+
+#include "ElementArena.h"
+
+// Slabs start small so tiny groups stay tiny and double up to the limit
+const size_t first_slab_size = 16 * 1024;
+const size_t max_slab_size = 4 * 1024 * 1024;
+const size_t block_alignment = alignof(max_align_t);
+
+ElementArena::ElementArena()
+{
+  slab_size = first_slab_size;
+  reserved = 0;
+  next = NULL;
+  end = NULL;
+  free_size = 0;
+  free_list = NULL;
+}
+
+ElementArena::~ElementArena()
+{
+  for (size_t idx = 0; idx < slabs.size(); idx++)
+    {
+      ::operator delete(slabs[idx]);
+    }
+}
+
+void *
+ElementArena::allocate(size_t bytes)
+{
+  bytes = (bytes + block_alignment - 1) & ~(block_alignment - 1);
+
+  if (bytes == free_size && free_list != NULL)
+    {
+      void *block = free_list;
+
+      free_list = *static_cast<void **>(block);
+      return block;
+    }
+
+  if (next == NULL || static_cast<size_t>(end - next) < bytes)
+    {
+      // An oversized request gets a slab of its own
+      size_t size = (bytes > slab_size / 4) ? bytes : slab_size;
+      char *slab = static_cast<char *>(::operator new(size));
+
+      slabs.push_back(slab);
+      reserved += size;
+      if (size != bytes)
+        {
+          next = slab;
+          end = slab + size;
+          if (slab_size < max_slab_size)
+            {
+              slab_size *= 2;
+            }
+        }
+      else
+        {
+          return slab;
+        }
+    }
+
+  void *block = next;
+  next += bytes;
+  return block;
+}
+
+// Blocks of the common size go on the free list.  Anything else stays
+// in its slab until the arena is released.
+void
+ElementArena::deallocate(void *block, size_t bytes)
+{
+  bytes = (bytes + block_alignment - 1) & ~(block_alignment - 1);
+
+  if (free_size == 0)
+    {
+      free_size = bytes;
+    }
+  if (bytes == free_size)
+    {
+      *static_cast<void **>(block) = free_list;
+      free_list = block;
+    }
+}
+
+size_t
+ElementArena::get_reserved(void) const
+{
+  return reserved;
+}
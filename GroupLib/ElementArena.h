@@ -0,0 +1,116 @@
+/******************************************************************************/
+/*                                                                            */
+/*  ElementArena.h Definitions for the slab storage behind group elements    */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef ELEMENT_ARENA_H__
+#define ELEMENT_ARENA_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Bump allocation out of large slabs.  Freed blocks of the common block
+// size are kept for reuse and everything is released at once when the
+// arena goes away.  Not thread safe, like the Group that owns it.
+class ElementArena
+{
+ public:
+  ElementArena();
+  ~ElementArena();
+
+  void *allocate(size_t bytes);
+  void deallocate(void *block, size_t bytes);
+
+  // Bytes taken from the system for slabs
+  size_t get_reserved(void) const;
+
+ private:
+  ElementArena(const ElementArena &);
+  ElementArena &operator =(const ElementArena &);
+
+  std::vector<char *> slabs;
+  size_t slab_size;
+  size_t reserved;
+  char *next;
+  char *end;
+
+  // The first size freed; set nodes all share one size
+  size_t free_size;
+  void *free_list;
+};
+
+// Allocator for the Group element set.  Each container gets its own
+// arena, a copied container included, and the arena lives until the last
+// node allocated from it is gone.
+template <typename T>
+class ArenaAllocator
+{
+ public:
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+  typedef std::false_type propagate_on_container_copy_assignment;
+
+  ArenaAllocator() : arena(std::make_shared<ElementArena>()) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) {}
+
+  T *allocate(size_t n)
+  {
+    return static_cast<T *>(arena->allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T *block, size_t n)
+  {
+    arena->deallocate(block, n * sizeof(T));
+  }
+
+  ArenaAllocator select_on_container_copy_construction(void) const
+  {
+    return ArenaAllocator();
+  }
+
+  std::shared_ptr<ElementArena> arena;
+};
+
+template <typename T, typename U>
+bool
+operator ==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs)
+{
+  return lhs.arena == rhs.arena;
+}
+
+template <typename T, typename U>
+bool
+operator !=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs)
+{
+  return lhs.arena != rhs.arena;
+}
+
+#endif // ELEMENT_ARENA_H__
@@ -0,0 +1,169 @@
+/******************************************************************************/
+/*                                                                            */
+/*  ElementBatch.cpp: Multiplying packed element values by one element        */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+
+#include "ElementBatch.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ELEMENT_BATCH_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
+void
+multiply_packed_values_scalar(const char *values, uint32_t count,
+                              uint32_t order, const std::string &fixed,
+                              GrpElDirection_t side, char *products)
+{
+  size_t bytes = static_cast<size_t>(count) * order;
+
+  if (side == GrpElDirection_left)
+    {
+      // Each byte independently: (f * v)[i] = f[v[i]]
+      for (size_t pos = 0; pos < bytes; pos++)
+        {
+          products[pos] = fixed[values[pos] - '0'];
+        }
+      return;
+    }
+
+  // (v * f)[i] = v[f[i]], through a copy of the element in case the
+  // products overwrite the values
+  char element[max_order];
+
+  for (size_t pos = 0; pos < bytes; pos += order)
+    {
+      memcpy(element, values + pos, order);
+      for (uint32_t i = 0; i < order; i++)
+        {
+          products[pos + i] = element[fixed[i] - '0'];
+        }
+    }
+}
+
+#ifdef ELEMENT_BATCH_SSSE3
+
+__attribute__((target("ssse3")))
+static void
+multiply_packed_values_ssse3(const char *values, uint32_t count,
+                             uint32_t order, const std::string &fixed,
+                             GrpElDirection_t side, char *products)
+{
+  size_t bytes = static_cast<size_t>(count) * order;
+  size_t pos = 0;
+  char lanes[16];
+
+  if (side == GrpElDirection_left)
+    {
+      // The register holds fixed as a lookup table indexed by value
+      memset(lanes, '0', sizeof(lanes));
+      memcpy(lanes, fixed.data(), order);
+
+      __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes));
+      __m128i zero = _mm_set1_epi8('0');
+
+      for (; pos + 16 <= bytes; pos += 16)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + pos));
+
+          v = _mm_shuffle_epi8(table, _mm_sub_epi8(v, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(products + pos), v);
+        }
+      for (; pos < bytes; pos++)
+        {
+          products[pos] = fixed[values[pos] - '0'];
+        }
+      return;
+    }
+  else
+    {
+      // Each whole element in the register has its bytes moved by fixed.
+      // The bytes past the last whole element are written back unchanged
+      // and redone with the next load.
+      uint32_t whole = 16 / order;
+      size_t step = static_cast<size_t>(whole) * order;
+
+      for (uint32_t lane = 0; lane < 16; lane++)
+        {
+          uint32_t element = lane / order;
+
+          lanes[lane] = (element < whole)
+            ? element * order + (fixed[lane % order] - '0')
+            : lane;
+        }
+
+      __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes));
+
+      for (; pos + 16 <= bytes; pos += step)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + pos));
+
+          v = _mm_shuffle_epi8(v, mask);
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(products + pos), v);
+        }
+    }
+
+  // Fewer whole elements than a register holds are left
+  multiply_packed_values_scalar(values + pos, (bytes - pos) / order, order,
+                                fixed, side, products + pos);
+}
+
+#endif // ELEMENT_BATCH_SSSE3
+
+GrpErr_t
+multiply_packed_values(const char *values, uint32_t count,
+                       uint32_t order, const std::string &fixed,
+                       GrpElDirection_t side, char *products)
+{
+  if (order == 0 || order > max_order)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  if (fixed.size() != order)
+    {
+      return GrpErr_OrderMismatch;
+    }
+  if (side != GrpElDirection_left && side != GrpElDirection_right)
+    {
+      return GrpErr_BadRotationDirection;
+    }
+
+#ifdef ELEMENT_BATCH_SSSE3
+  static const bool have_ssse3 = __builtin_cpu_supports("ssse3");
+
+  if (have_ssse3)
+    {
+      multiply_packed_values_ssse3(values, count, order, fixed, side,
+                                   products);
+      return GrpErr_OK;
+    }
+#endif
+
+  multiply_packed_values_scalar(values, count, order, fixed, side, products);
+  return GrpErr_OK;
+}
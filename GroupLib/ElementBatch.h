@@ -0,0 +1,55 @@
+/******************************************************************************/
+/*                                                                            */
+/*  ElementBatch.h Multiplying packed element values by one element           */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef ELEMENT_BATCH_H__
+#define ELEMENT_BATCH_H__
+
+#include <stdint.h>
+
+#include <string>
+
+#include "GroupElement.h"
+
+// Multiplies count element values of the given order, packed back to back
+// as by Group::get_packed_values, by the one value fixed:
+//   GrpElDirection_left   products[k] = fixed * values[k]
+//   GrpElDirection_right  products[k] = values[k] * fixed
+// The products are packed the same way; products may be values itself.
+// Nothing is checked beyond the sizes, so the values must be valid.
+//
+// On x86 processors with SSSE3 sixteen bytes are done per shuffle: a left
+// product looks every byte up in fixed and a right product moves the
+// bytes of each whole element held in the register.
+GrpErr_t multiply_packed_values(const char *values, uint32_t count,
+                                uint32_t order, const std::string &fixed,
+                                GrpElDirection_t side, char *products);
+
+// The element at a time loop, for comparison and for other processors
+void multiply_packed_values_scalar(const char *values, uint32_t count,
+                                   uint32_t order, const std::string &fixed,
+                                   GrpElDirection_t side, char *products);
+
+#endif // ELEMENT_BATCH_H__
@@ -0,0 +1,694 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Factorization.cpp: Writing elements as words in generators                */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "OrderProfile.h"
+#include "Factorization.h"
+
+// How an element was first reached in a word search: it is
+// parent * generator, or parent * generator^-1 searching back
+typedef struct
+{
+  uint64_t parent;
+  uint32_t generator;
+  uint32_t depth;
+} WordStep;
+
+typedef struct
+{
+  std::unordered_map<uint64_t, WordStep> tree;
+  std::vector<uint64_t> frontier;
+  uint32_t depth;
+  std::vector<std::string> steps;
+} SearchSide;
+
+static std::string
+identity_value(uint32_t order)
+{
+  std::string identity(order, '0');
+
+  for (uint32_t i = 0; i < order; i++)
+    {
+      identity[i] += i;
+    }
+  return identity;
+}
+
+static bool
+is_identity_value(const std::string &value)
+{
+  for (uint32_t i = 0; i < value.size(); i++)
+    {
+      if (value[i] != static_cast<char>('0' + i))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+static GrpErr_t
+check_generators(const std::vector<GroupElement> &generators, uint32_t order)
+{
+  if (order == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  for (uint32_t idx = 0; idx < generators.size(); idx++)
+    {
+      if (generators[idx].get_order() != order)
+        {
+          return GrpErr_OrderMismatch;
+        }
+    }
+  return GrpErr_OK;
+}
+
+GrpErr_t
+evaluate_word(const std::vector<GroupElement> &generators,
+              const Word_t &word, GroupElement &product)
+{
+  if (generators.empty())
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+
+  uint32_t order = generators[0].get_order();
+  GrpErr_t result = check_generators(generators, order);
+
+  if (result != GrpErr_OK)
+    {
+      return result;
+    }
+
+  std::string value = identity_value(order);
+  std::string next;
+
+  for (uint32_t idx = 0; idx < word.size(); idx++)
+    {
+      if (word[idx] >= generators.size())
+        {
+          return GrpErr_IndexOutOfBounds;
+        }
+      multiply_element_values(value, generators[word[idx]].get_element(), next);
+      value.swap(next);
+    }
+  product.set_order(order);
+  product.set_element(value);
+  return GrpErr_OK;
+}
+
+GrpErr_t
+shortest_word(const std::vector<GroupElement> &generators,
+              const GroupElement &target, Word_t &word,
+              uint64_t max_elements)
+{
+  uint32_t order = target.get_order();
+  GrpErr_t result = check_generators(generators, order);
+
+  word.clear();
+  if (result != GrpErr_OK)
+    {
+      return result;
+    }
+
+  SearchSide forward;
+  SearchSide back;
+  uint64_t start = 0;
+  uint64_t goal = rank_element_value(target.get_element());
+
+  for (uint32_t idx = 0; idx < generators.size(); idx++)
+    {
+      std::string inverse;
+
+      forward.steps.push_back(generators[idx].get_element());
+      invert_element_value(forward.steps.back(), inverse);
+      back.steps.push_back(inverse);
+    }
+  forward.tree[start] = WordStep{start, 0, 0};
+  forward.frontier.push_back(start);
+  forward.depth = 0;
+  back.tree[goal] = WordStep{goal, 0, 0};
+  back.frontier.push_back(goal);
+  back.depth = 0;
+
+  uint64_t meeting = goal;
+  uint32_t best_length = (start == goal) ? 0 : UINT32_MAX;
+  char value[max_order];
+  char product[max_order];
+
+  while (best_length == UINT32_MAX)
+    {
+      if (forward.frontier.empty() || back.frontier.empty())
+        {
+          return GrpErr_MissingElement;
+        }
+
+      // A whole level of the smaller side, so the first meeting level
+      // holds a shortest word
+      bool grow_forward = forward.frontier.size() <= back.frontier.size();
+      SearchSide &grow = grow_forward ? forward : back;
+      SearchSide &other = grow_forward ? back : forward;
+      std::vector<uint64_t> next;
+
+      for (uint64_t f = 0; f < grow.frontier.size(); f++)
+        {
+          unrank_element_value(order, grow.frontier[f], value);
+          for (uint32_t s = 0; s < grow.steps.size(); s++)
+            {
+              for (uint32_t i = 0; i < order; i++)
+                {
+                  product[i] = value[grow.steps[s][i] - '0'];
+                }
+
+              uint64_t rank = rank_element_value(product, order);
+
+              if (grow.tree.find(rank) != grow.tree.end())
+                {
+                  continue;
+                }
+              grow.tree[rank] = WordStep{grow.frontier[f], s, grow.depth + 1};
+              next.push_back(rank);
+
+              std::unordered_map<uint64_t, WordStep>::const_iterator met = other.tree.find(rank);
+
+              if (met != other.tree.end() && grow.depth + 1 + met->second.depth < best_length)
+                {
+                  best_length = grow.depth + 1 + met->second.depth;
+                  meeting = rank;
+                }
+            }
+          if (grow.tree.size() > max_elements)
+            {
+              return GrpErr_ElementOverflow;
+            }
+        }
+      grow.frontier.swap(next);
+      grow.depth++;
+    }
+
+  // Back to the identity for the first half of the word, then on to
+  // the target since meeting * generator leads towards it
+  for (uint64_t rank = meeting; rank != start; )
+    {
+      const WordStep &step = forward.tree[rank];
+
+      word.push_back(step.generator);
+      rank = step.parent;
+    }
+  std::reverse(word.begin(), word.end());
+  for (uint64_t rank = meeting; rank != goal; )
+    {
+      const WordStep &step = back.tree[rank];
+
+      word.push_back(step.generator);
+      rank = step.parent;
+    }
+  return GrpErr_OK;
+}
+
+// Passes over the chain combining its own entries
+const uint32_t chain_improve_rounds = 2;
+
+// Appends from to to, cancelling a letter against its inverse
+static void
+append_letters(std::vector<int32_t> &to, const std::vector<int32_t> &from)
+{
+  for (uint32_t idx = 0; idx < from.size(); idx++)
+    {
+      if (!to.empty() && to.back() == -from[idx])
+        {
+          to.pop_back();
+        }
+      else
+        {
+          to.push_back(from[idx]);
+        }
+    }
+}
+
+static std::vector<int32_t>
+inverse_letters(const std::vector<int32_t> &letters)
+{
+  std::vector<int32_t> inverse(letters.rbegin(), letters.rend());
+
+  for (uint32_t idx = 0; idx < inverse.size(); idx++)
+    {
+      inverse[idx] = -inverse[idx];
+    }
+  return inverse;
+}
+
+// lhs^-1 * rhs
+static std::string
+divide_values(const std::string &lhs, const std::string &rhs)
+{
+  std::string inverse;
+  std::string quotient;
+
+  invert_element_value(lhs, inverse);
+  multiply_element_values(inverse, rhs, quotient);
+  return quotient;
+}
+
+FactorizationChain::FactorizationChain()
+{
+  clear();
+}
+
+FactorizationChain::~FactorizationChain()
+{
+}
+
+void
+FactorizationChain::clear(void)
+{
+  element_order = 0;
+  generator_orders.clear();
+  levels.clear();
+}
+
+void
+FactorizationChain::add_level(const std::string &moved)
+{
+  ChainLevel level;
+
+  level.base = 0;
+  while (moved[level.base] == static_cast<char>('0' + level.base))
+    {
+      level.base++;
+    }
+  levels.push_back(level);
+}
+
+void
+FactorizationChain::build_orbit(ChainLevel &level)
+{
+  level.transversal.assign(element_order, WordedElement());
+  level.transversal[level.base].value = identity_value(element_order);
+  level.orbit.assign(1, level.base);
+
+  for (uint32_t idx = 0; idx < level.orbit.size(); idx++)
+    {
+      uint32_t point = level.orbit[idx];
+
+      for (uint32_t s = 0; s < level.strong.size(); s++)
+        {
+          const WordedElement &generator = level.strong[s];
+          uint32_t image = generator.value[point] - '0';
+
+          if (!level.transversal[image].value.empty())
+            {
+              continue;
+            }
+
+          WordedElement &u = level.transversal[image];
+
+          multiply_element_values(generator.value,
+                                  level.transversal[point].value, u.value);
+          u.letters = generator.letters;
+          append_letters(u.letters, level.transversal[point].letters);
+          level.orbit.push_back(image);
+        }
+    }
+}
+
+// Sifts x through the levels from first_level, returning the level whose
+// orbit does not hold the image of its base point, or the chain length
+uint32_t
+FactorizationChain::strip(WordedElement &x, uint32_t first_level) const
+{
+  for (uint32_t l = first_level; l < levels.size(); l++)
+    {
+      const WordedElement &u = levels[l].transversal[x.value[levels[l].base] - '0'];
+
+      if (u.value.empty())
+        {
+          return l;
+        }
+      x.value = divide_values(u.value, x.value);
+
+      Letters letters = inverse_letters(u.letters);
+
+      append_letters(letters, x.letters);
+      x.letters.swap(letters);
+    }
+  return levels.size();
+}
+
+GrpErr_t
+FactorizationChain::generate(const std::vector<GroupElement> &chain_generators,
+                             bool short_words)
+{
+  clear();
+
+  if (chain_generators.empty())
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+
+  GrpErr_t result = check_generators(chain_generators,
+                                     chain_generators[0].get_order());
+
+  if (result != GrpErr_OK)
+    {
+      return result;
+    }
+  element_order = chain_generators[0].get_order();
+
+  for (uint32_t idx = 0; idx < chain_generators.size(); idx++)
+    {
+      WordedElement g;
+
+      g.value = chain_generators[idx].get_element();
+      g.letters.assign(1, idx + 1);
+      generator_orders.push_back(element_value_order(g.value.data(),
+                                                     element_order));
+      if (is_identity_value(g.value))
+        {
+          continue;
+        }
+
+      uint32_t fixed = 0;
+
+      while (fixed < levels.size()
+             && g.value[levels[fixed].base] == static_cast<char>('0' + levels[fixed].base))
+        {
+          fixed++;
+        }
+      if (fixed == levels.size())
+        {
+          add_level(g.value);
+        }
+      for (uint32_t l = 0; l <= fixed; l++)
+        {
+          levels[l].strong.push_back(g);
+        }
+    }
+  for (uint32_t l = 0; l < levels.size(); l++)
+    {
+      build_orbit(levels[l]);
+    }
+
+  // Schreier-Sims: every Schreier generator of a level must sift through
+  // the levels below it, otherwise what is left joins them
+  int32_t i = static_cast<int32_t>(levels.size()) - 1;
+
+  while (i >= 0)
+    {
+      bool added = false;
+
+      for (uint32_t o = 0; o < levels[i].orbit.size() && !added; o++)
+        {
+          uint32_t point = levels[i].orbit[o];
+
+          for (uint32_t s = 0; s < levels[i].strong.size() && !added; s++)
+            {
+              const WordedElement &generator = levels[i].strong[s];
+              const WordedElement &u_point = levels[i].transversal[point];
+              const WordedElement &u_image = levels[i].transversal[generator.value[point] - '0'];
+              WordedElement h;
+              std::string moved;
+
+              // u_image^-1 * generator * u_point fixes the base point
+              multiply_element_values(generator.value, u_point.value, moved);
+              h.value = divide_values(u_image.value, moved);
+              if (is_identity_value(h.value))
+                {
+                  continue;
+                }
+              h.letters = inverse_letters(u_image.letters);
+              append_letters(h.letters, generator.letters);
+              append_letters(h.letters, u_point.letters);
+
+              uint32_t j = strip(h, i + 1);
+
+              if (j == levels.size() && is_identity_value(h.value))
+                {
+                  continue;
+                }
+              if (j == levels.size())
+                {
+                  add_level(h.value);
+                }
+              for (uint32_t l = i + 1; l <= j; l++)
+                {
+                  levels[l].strong.push_back(h);
+                  build_orbit(levels[l]);
+                }
+              i = j;
+              added = true;
+            }
+        }
+      if (!added)
+        {
+          i--;
+        }
+    }
+  if (short_words)
+    {
+      improve_words(chain_generators);
+    }
+  return GrpErr_OK;
+}
+
+// Inverse letters count as order - 1 generators
+uint64_t
+FactorizationChain::word_length(const Letters &letters) const
+{
+  uint64_t length = 0;
+
+  for (uint32_t idx = 0; idx < letters.size(); idx++)
+    {
+      length += letters[idx] > 0 ? 1 : generator_orders[-letters[idx] - 1] - 1;
+    }
+  return length;
+}
+
+// Sifts x, keeping it wherever its word beats the transversal's
+void
+FactorizationChain::improve_entry(WordedElement x)
+{
+  for (uint32_t l = 0; l < levels.size() && !is_identity_value(x.value); l++)
+    {
+      WordedElement &u = levels[l].transversal[x.value[levels[l].base] - '0'];
+
+      if (word_length(x.letters) < word_length(u.letters))
+        {
+          u = x;
+          return;
+        }
+      x.value = divide_values(u.value, x.value);
+
+      Letters letters = inverse_letters(u.letters);
+
+      append_letters(letters, x.letters);
+      x.letters.swap(letters);
+    }
+}
+
+void
+FactorizationChain::improve_words(const std::vector<GroupElement> &chain_generators)
+{
+  std::unordered_map<uint64_t, WordStep> tree;
+  std::vector<std::string> found;
+  std::vector<Letters> words;
+  std::string identity = identity_value(element_order);
+
+  tree[rank_element_value(identity)] = WordStep{0, 0, 0};
+  found.push_back(identity);
+  words.push_back(Letters());
+
+  // Breadth first, so each element is reached by a shortest word
+  for (uint64_t idx = 0; idx < found.size() && found.size() < chain_search_elements; idx++)
+    {
+      for (uint32_t g = 0; g < chain_generators.size(); g++)
+        {
+          std::string product;
+
+          multiply_element_values(found[idx], chain_generators[g].get_element(), product);
+
+          uint64_t rank = rank_element_value(product);
+
+          if (tree.find(rank) != tree.end())
+            {
+              continue;
+            }
+          tree[rank] = WordStep{idx, g, 0};
+          found.push_back(product);
+          words.push_back(words[idx]);
+          words.back().push_back(g + 1);
+        }
+    }
+
+  for (uint64_t idx = 1; idx < found.size(); idx++)
+    {
+      WordedElement x;
+
+      x.value = found[idx];
+      x.letters = words[idx];
+      improve_entry(x);
+    }
+
+  // Products of a level's own entries are in its stabilizer as well and
+  // bring the short words down to the levels the search did not reach
+  for (uint32_t round = 0; round < chain_improve_rounds; round++)
+    {
+      for (uint32_t l = 0; l < levels.size(); l++)
+        {
+          std::vector<WordedElement> entries;
+
+          for (uint32_t o = 0; o < levels[l].orbit.size(); o++)
+            {
+              entries.push_back(levels[l].transversal[levels[l].orbit[o]]);
+            }
+          for (uint32_t a = 1; a < entries.size(); a++)
+            {
+              for (uint32_t b = 1; b < entries.size(); b++)
+                {
+                  WordedElement x;
+
+                  multiply_element_values(entries[a].value, entries[b].value, x.value);
+                  x.letters = entries[a].letters;
+                  append_letters(x.letters, entries[b].letters);
+                  improve_entry(x);
+                }
+            }
+        }
+    }
+}
+
+uint64_t
+FactorizationChain::size(void) const
+{
+  uint64_t order = 1;
+
+  for (uint32_t l = 0; l < levels.size(); l++)
+    {
+      order *= levels[l].orbit.size();
+    }
+  return order;
+}
+
+uint32_t
+FactorizationChain::get_base_length(void) const
+{
+  return levels.size();
+}
+
+// Writes inverses as powers and drops whole powers of a generator
+// equal to the identity
+void
+FactorizationChain::letters_to_word(const Letters &letters, Word_t &word) const
+{
+  std::vector<std::pair<uint32_t, uint32_t> > runs;
+
+  for (uint32_t idx = 0; idx < letters.size(); idx++)
+    {
+      uint32_t generator = abs(letters[idx]) - 1;
+      uint32_t power = generator_orders[generator];
+      uint32_t count = letters[idx] > 0 ? 1 : power - 1;
+
+      if (runs.empty() || runs.back().first != generator)
+        {
+          runs.push_back(std::make_pair(generator, 0u));
+        }
+      runs.back().second = (runs.back().second + count) % power;
+      if (runs.back().second == 0)
+        {
+          runs.pop_back();
+        }
+    }
+
+  word.clear();
+  for (uint32_t r = 0; r < runs.size(); r++)
+    {
+      word.insert(word.end(), runs[r].second, runs[r].first);
+    }
+}
+
+GrpErr_t
+FactorizationChain::factorize(const GroupElement &target, Word_t &word) const
+{
+  word.clear();
+  if (target.get_order() != element_order)
+    {
+      return GrpErr_OrderMismatch;
+    }
+
+  WordedElement x;
+  Letters letters;
+
+  // target = u_0 * u_1 * ... taking one transversal element per level
+  x.value = target.get_element();
+  for (uint32_t l = 0; l < levels.size(); l++)
+    {
+      const WordedElement &u = levels[l].transversal[x.value[levels[l].base] - '0'];
+
+      if (u.value.empty())
+        {
+          return GrpErr_MissingElement;
+        }
+      append_letters(letters, u.letters);
+      x.value = divide_values(u.value, x.value);
+    }
+  if (!is_identity_value(x.value))
+    {
+      return GrpErr_MissingElement;
+    }
+  letters_to_word(letters, word);
+  return GrpErr_OK;
+}
+
+GrpErr_t
+factorize_element(const std::vector<GroupElement> &generators,
+                  const GroupElement &target, Word_t &word,
+                  uint64_t max_elements)
+{
+  GrpErr_t result = shortest_word(generators, target, word, max_elements);
+
+  if (result != GrpErr_ElementOverflow)
+    {
+      return result;
+    }
+
+  FactorizationChain chain;
+
+  result = chain.generate(generators);
+  if (result != GrpErr_OK)
+    {
+      return result;
+    }
+  return chain.factorize(target, word);
+}
@@ -0,0 +1,123 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Factorization.h Writing elements as words in generators                   */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef FACTORIZATION_H__
+#define FACTORIZATION_H__
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+
+// A word in the generators by their indices, standing for the product
+// generators[word[0]] * generators[word[1]] * ...
+typedef std::vector<uint32_t> Word_t;
+
+// Elements each side of the shortest word search may hold by default
+const uint64_t default_word_search = 1 << 21;
+// Elements of the breadth first search whose words improve the chain
+const uint64_t chain_search_elements = 1 << 16;
+
+// Multiplies the word out, the identity for the empty word
+GrpErr_t evaluate_word(const std::vector<GroupElement> &generators,
+                       const Word_t &word, GroupElement &product);
+
+// A shortest word for target.  The words from the identity and those
+// back from the target are grown a level at a time in hashed sets,
+// always the smaller side, until they meet.  GrpErr_ElementOverflow
+// once a side holds more than max_elements, GrpErr_MissingElement when
+// the generators cannot reach target.
+GrpErr_t shortest_word(const std::vector<GroupElement> &generators,
+                       const GroupElement &target, Word_t &word,
+                       uint64_t max_elements = default_word_search);
+
+// A stabilizer chain built by Schreier-Sims whose transversal elements
+// carry words in the generators.  Sifting through it factors any element
+// of the group quickly, though the words are not the shortest.  The
+// Schreier generator words grow with each level, so the short words of a
+// breadth first search are sifted through the chain afterwards and
+// replace any longer transversal words they meet, as Minkwitz does.
+class FactorizationChain
+{
+ public:
+  FactorizationChain();
+  ~FactorizationChain();
+
+  // Without short_words only the chain is built, enough for size()
+  GrpErr_t generate(const std::vector<GroupElement> &chain_generators,
+                    bool short_words = true);
+  void clear(void);
+
+  // The order of the generated group, the product of the orbit lengths
+  uint64_t size(void) const;
+  uint32_t get_base_length(void) const;
+
+  // GrpErr_MissingElement when target is not in the group
+  GrpErr_t factorize(const GroupElement &target, Word_t &word) const;
+
+ private:
+  // Letters are i + 1 for generator i and -(i + 1) for its inverse
+  typedef std::vector<int32_t> Letters;
+
+  typedef struct
+  {
+    std::string value;
+    Letters letters;
+  } WordedElement;
+
+  typedef struct
+  {
+    uint32_t base;
+    // Generators of the stabilizer of the earlier base points
+    std::vector<WordedElement> strong;
+    // transversal[p] takes the base point to p; empty outside the orbit
+    std::vector<WordedElement> transversal;
+    std::vector<uint32_t> orbit;
+  } ChainLevel;
+
+  void build_orbit(ChainLevel &level);
+  void add_level(const std::string &moved);
+  uint32_t strip(WordedElement &x, uint32_t first_level) const;
+  void improve_words(const std::vector<GroupElement> &chain_generators);
+  void improve_entry(WordedElement x);
+  uint64_t word_length(const Letters &letters) const;
+  void letters_to_word(const Letters &letters, Word_t &word) const;
+
+  uint32_t element_order;
+  std::vector<uint32_t> generator_orders;
+  std::vector<ChainLevel> levels;
+};
+
+// A shortest word when one is found within max_elements, otherwise the
+// stabilizer chain's word
+GrpErr_t factorize_element(const std::vector<GroupElement> &generators,
+                           const GroupElement &target, Word_t &word,
+                           uint64_t max_elements = default_word_search);
+
+#endif // FACTORIZATION_H__
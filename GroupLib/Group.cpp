@@ -24,12 +24,19 @@
 /******************************************************************************/
 
 #include <stdint.h>
+#include <stdlib.h>
+#include <istream>
 #include <string>
 #include <algorithm>   // std::rotate
+#include <deque>
+#include <unordered_set>
 
 #include "GroupError.h"
 #include "GroupElement.h"
 #include "Group.h"
+#include "GroupStream.h"
+#include "ElementBatch.h"
+#include "CycleNotation.h"
 
 const std::string group_error_code[] =
   {
@@ -37,10 +44,138 @@ const std::string group_error_code[] =
     "Uknown Error"
   };
 
+// Above this many permutations (order!) the rank index is hashed
+const uint64_t dense_rank_limit = 1 << 24;
+
+// True when the order characters at value are a permutation of 0 to
+// order - 1, so its rank is below order!
+static bool
+is_permutation_value(const char *value, uint32_t order)
+{
+  uint32_t seen = 0;
+
+  for (uint32_t i = 0; i < order; i++)
+    {
+      uint32_t digit = static_cast<uint8_t>(value[i] - '0');
+
+      if ((digit >= order) || (seen & (1u << digit)))
+        {
+          return false;
+        }
+      seen |= 1u << digit;
+    }
+  return true;
+}
+
+// Adds a generator to a closed set of members and closes it again.  Old
+// members are closed under the old generators so only products with the
+// new generator can start a new element.
+static void
+extend_closure(const std::string &generator,
+               std::vector<std::string> &members,
+               std::unordered_set<uint64_t> &member_ranks,
+               std::vector<std::string> &generators)
+{
+  std::string product;
+
+  generators.push_back(generator);
+
+  size_t old_members = members.size();
+  for (size_t idx = 0; idx < old_members; idx++)
+    {
+      multiply_element_values(members[idx], generator, product);
+      if (member_ranks.insert(rank_element_value(product)).second)
+        {
+          members.push_back(product);
+        }
+    }
+  // New members are closed under all of the generators
+  for (size_t idx = old_members; idx < members.size(); idx++)
+    {
+      for (size_t g = 0; g < generators.size(); g++)
+        {
+          multiply_element_values(members[idx], generators[g], product);
+          if (member_ranks.insert(rank_element_value(product)).second)
+            {
+              members.push_back(product);
+            }
+        }
+    }
+}
+
+// The smallest subgroup holding the seeds that is normalized by the
+// conjugators.  With no conjugators this is the subgroup generated by
+// the seeds.  members starts with the identity.
+static void
+normal_closure(const std::vector<std::string> &seeds,
+               const std::vector<std::string> &conjugators,
+               std::vector<std::string> &members,
+               std::vector<std::string> &generators)
+{
+  std::unordered_set<uint64_t> member_ranks;
+  std::string identity_value;
+  std::string inverse;
+  std::string product;
+  std::string conjugate;
+
+  members.clear();
+  generators.clear();
+  if (seeds.empty())
+    {
+      return;
+    }
+
+  for (uint32_t i = 0; i < seeds[0].size(); i++)
+    {
+      identity_value += i + '0';
+    }
+  members.push_back(identity_value);
+  member_ranks.insert(0);
+
+  for (size_t idx = 0; idx < seeds.size(); idx++)
+    {
+      if (member_ranks.find(rank_element_value(seeds[idx])) == member_ranks.end())
+        {
+          extend_closure(seeds[idx], members, member_ranks, generators);
+        }
+    }
+
+  // Every generator, including those added here, is conjugated by
+  // every conjugator
+  for (size_t n = 0; n < generators.size(); n++)
+    {
+      for (size_t g = 0; g < conjugators.size(); g++)
+        {
+          invert_element_value(conjugators[g], inverse);
+          multiply_element_values(inverse, generators[n], product);
+          multiply_element_values(product, conjugators[g], conjugate);
+          if (member_ranks.find(rank_element_value(conjugate)) == member_ranks.end())
+            {
+              extend_closure(conjugate, members, member_ranks, generators);
+            }
+        }
+    }
+}
+
+static uint64_t
+factorial(uint32_t n)
+{
+  uint64_t f = 1;
+
+  for (uint32_t i = 2; i <= n; i++)
+    {
+      f *= i;
+    }
+  return f;
+}
+
 
 Group::Group()
 {
   group_order = 0;
+  index_valid = false;
+  indexed_size = 0;
+  element_order = 0;
 }
 
 Group::~Group()
@@ -50,13 +185,19 @@ Group::~Group()
 void
 Group::erase(void)
 {
-  elements.clear();
+  // A fresh set drops the old arena and all of its slabs at once
+  elements = ElementSet();
+  generators.clear();
+  invalidate_index();
 }
 
 void
 Group::clear(void)
 {
-  elements.clear();
+  // A fresh set drops the old arena and all of its slabs at once
+  elements = ElementSet();
+  generators.clear();
+  invalidate_index();
   identity.clear();
   group_order = 0;
 }
@@ -86,7 +227,11 @@ Group::add_element(GroupElement &e)
 {
   GrpErr_t rVal = GrpErr_OK;
 
-  elements.insert(e);
+  if (elements.insert(e).second)
+    {
+      generators.clear();
+      invalidate_index();
+    }
 
   return rVal;
 }
@@ -99,7 +244,7 @@ Group::delete_element(uint32_t index)
       return GrpErr_IndexOutOfBounds;
     }
 
-  std::set<GroupElement>::iterator iter;
+  ElementSet::iterator iter;
   uint32_t local_index = 0;
 
   for (iter = elements.begin(); iter != elements.end(); ++iter, local_index++)
@@ -107,6 +252,8 @@ Group::delete_element(uint32_t index)
       if (index == local_index)
         {
           elements.erase(iter);
+          generators.clear();
+          invalidate_index();
           return GrpErr_OK;
         }
     }
@@ -132,6 +279,151 @@ Group::generate(GroupElement &e)
       new_element *= e;
     }
 
+  if (e != ident)
+    {
+      generators.push_back(e);
+    }
+
+  return rVal;
+}
+
+GrpErr_t
+Group::generate(const std::vector<GroupElement> &group_generators)
+{
+  std::vector<std::string> generator_values;
+  std::vector<std::string> no_conjugators;
+  std::vector<std::string> members;
+  std::vector<std::string> closure_generators;
+
+  if (group_generators.empty())
+    {
+      return GrpErr_ElementValueNull;
+    }
+  for (uint32_t idx = 0; idx < group_generators.size(); idx++)
+    {
+      if (group_generators[idx].get_order() != group_generators[0].get_order())
+        {
+          return GrpErr_IncompatibleGroupElement;
+        }
+      generator_values.push_back(group_generators[idx].get_element());
+    }
+
+  normal_closure(generator_values, no_conjugators, members, closure_generators);
+  set_members(members, closure_generators);
+  return GrpErr_OK;
+}
+
+GrpErr_t
+Group::add_generator(const GroupElement &g, uint32_t &added)
+{
+  GrpErr_t rVal = GrpErr_OK;
+
+  added = 0;
+  if (g.get_order() == 0)
+    {
+      return GrpErr_ElementValueNull;
+    }
+
+  std::string identity_value;
+
+  for (uint32_t i = 0; i < g.get_order(); i++)
+    {
+      identity_value += i + '0';
+    }
+  if (elements.empty())
+    {
+      if (!generators.empty())
+        {
+          // Given by set_generators, so materialize the old group first
+          std::vector<GroupElement> old_generators = generators;
+
+          rVal = generate(old_generators);
+          if (rVal != GrpErr_OK)
+            {
+              return rVal;
+            }
+        }
+      else
+        {
+          GroupElement ident;
+
+          ident.set_element(identity_value);
+          elements.insert(ident);
+          invalidate_index();
+        }
+    }
+  if (g.get_order() != get_element_order())
+    {
+      return GrpErr_IncompatibleGroupElement;
+    }
+
+  uint32_t element_index;
+
+  if (find_element(g, element_index))
+    {
+      return GrpErr_OK;
+    }
+
+  // The old generators first, as a generating set of H is needed below
+  std::vector<std::string> generator_values;
+  const std::vector<GroupElement> &old_generators = get_generators();
+
+  for (size_t idx = 0; idx < old_generators.size(); idx++)
+    {
+      generator_values.push_back(old_generators[idx].get_element());
+    }
+  generator_values.push_back(g.get_element());
+
+  const uint32_t order = get_element_order();
+  const uint32_t H_size = size();
+  const char *H_values = get_packed_values();
+  const size_t coset_bytes = static_cast<size_t>(H_size) * order;
+  std::unordered_set<uint64_t> new_ranks;
+  std::vector<std::string> representatives;
+  std::string new_values;
+  std::string product;
+
+  // Breadth first over the right cosets, starting from H itself.  H r s
+  // is the coset H (r s), so a product of a representative and a
+  // generator is either in a coset already made or names a new one.
+  representatives.push_back(identity_value);
+  for (size_t rep = 0; rep < representatives.size(); rep++)
+    {
+      for (size_t s = 0; s < generator_values.size(); s++)
+        {
+          multiply_element_values(representatives[rep], generator_values[s],
+                                  product);
+          if (find_value(product.data(), element_index) ||
+              (new_ranks.find(rank_element_value(product)) != new_ranks.end()))
+            {
+              continue;
+            }
+
+          size_t first = new_values.size();
+
+          new_values.resize(first + coset_bytes);
+          multiply_packed_values(H_values, H_size, order, product,
+                                 GrpElDirection_right, &new_values[first]);
+          for (size_t offset = first; offset < new_values.size(); offset += order)
+            {
+              new_ranks.insert(rank_element_value(&new_values[offset], order));
+            }
+          representatives.push_back(product);
+        }
+    }
+
+  // Only the new elements are inserted; the old ones stay where they are
+  GroupElement e;
+
+  for (size_t offset = 0; offset < new_values.size(); offset += order)
+    {
+      e.set_element(new_values.substr(offset, order));
+      elements.insert(e);
+    }
+  generators.push_back(g);
+  invalidate_index();
+  added = new_values.size() / order;
+
   return rVal;
 }
 
@@ -151,7 +443,36 @@ Group::generate_Sn(uint32_t order)
   // Default element is identity
   std::string value = element.get_element();
 
-  permute(value, 0, order - 1);
+  // The stream is in lexicographic order so each insert is at the end
+  rVal = for_each_Sn(order, [this](const std::string &element_value)
+    {
+      GroupElement e;
+
+      e.set_element(element_value);
+      elements.insert(elements.end(), e);
+      return true;
+    });
+  if (rVal != GrpErr_OK)
+    {
+      GroupError e(rVal);
+      throw e;
+    }
+
+  // A transposition and an n-cycle generate Sn
+  if (order >= 2)
+    {
+      std::string transposition = value;
+      std::swap(transposition[0], transposition[1]);
+      element.set_element(transposition);
+      generators.push_back(element);
+    }
+  if (order >= 3)
+    {
+      std::string cycle = value;
+      std::rotate(cycle.begin(), cycle.begin() + 1, cycle.end());
+      element.set_element(cycle);
+      generators.push_back(element);
+    }
   return rVal;
 }
 
@@ -193,16 +514,37 @@ Group::permute(std::string a, int32_t l, int32_t r)
 GrpErr_t
 Group::generate_An(uint32_t order)
 {
-  generate_Sn(order);
+  GrpErr_t rVal = GrpErr_OK;
 
-  std::set<GroupElement>::iterator itr;
+  erase();
 
-  for (itr = elements.begin(); itr != elements.end(); ++itr)
+  rVal = for_each_An(order, [this](const std::string &element_value)
     {
-      if (itr->is_odd())
-        {
-          elements.erase(itr);
-        }
+      GroupElement e;
+
+      e.set_element(element_value);
+      elements.insert(elements.end(), e);
+      return true;
+    });
+  if (rVal != GrpErr_OK)
+    {
+      GroupError e(rVal);
+      throw e;
+    }
+
+  // The 3-cycles (0 1 i) generate An
+  GroupElement element;
+  element.set_order(order);
+  std::string identity_value = element.get_element();
+
+  for (uint32_t i = 2; i < order; i++)
+    {
+      std::string cycle = identity_value;
+      cycle[0] = '1';
+      cycle[1] = i + '0';
+      cycle[i] = '0';
+      element.set_element(cycle);
+      generators.push_back(element);
     }
   return GrpErr_OK;
 }
@@ -216,7 +558,7 @@ Group::generate_Dn(uint32_t vertices)
   generate_Cn(vertices);
 
   std::vector<GroupElement> reflections;
-  std::set<GroupElement>::iterator itr;
+  ElementSet::iterator itr;
   GroupError error;
 
   // Set up an element where we can get a proper identity
@@ -263,7 +605,7 @@ Group::generate_Dn(uint32_t vertices)
           reflection_value = e.get_element();
 
           // Add the reflection on vertex
-          for (uint32_t idx2 = 0; idx2 < vertices/4; idx2++)
+          for (uint32_t idx2 = 0; idx2 < vertices/2 - 1; idx2++)
             {
               std::swap(reflection_value[right], reflection_value[left]);
               right++; right %= vertices;
@@ -279,7 +621,7 @@ Group::generate_Dn(uint32_t vertices)
           right = idx % vertices;
           left = (idx + vertices - 1) % vertices;
           // Add the reflection on the edge
-          for (uint32_t idx2 = 0; idx2 <= vertices/4; idx2++)
+          for (uint32_t idx2 = 0; idx2 < vertices/2; idx2++)
             {
               std::swap(reflection_value[right], reflection_value[left]);
               right++; right %= vertices;
@@ -290,6 +632,29 @@ Group::generate_Dn(uint32_t vertices)
         }
     }
 
+  // The rotation and the reflection through vertex 0 generate Dn
+  std::string rotation_value = e.get_element();
+  std::string reflection_value = e.get_element();
+
+  std::rotate(rotation_value.begin(),
+              rotation_value.begin() + 1,
+              rotation_value.end());
+  generators.clear();
+  for (uint32_t idx = 0; idx < vertices; idx++)
+    {
+      reflection_value[idx] = (vertices - idx) % vertices + '0';
+    }
+  if (rotation_value != e.get_element())
+    {
+      reflection.set_element(rotation_value);
+      generators.push_back(reflection);
+    }
+  if (reflection_value != e.get_element())
+    {
+      reflection.set_element(reflection_value);
+      generators.push_back(reflection);
+    }
+
   return rVal;
 }
 
@@ -327,17 +692,91 @@ Group::generate_Cn(uint32_t vertices)
 
     } while (element != new_element);
 
+  if (vertices > 1)
+    {
+      std::rotate(value.begin(), value.begin() + 1, value.end());
+      new_element.set_element(value);
+      generators.push_back(new_element);
+    }
+
   return rVal;
 }
 
 GrpErr_t
-Group::generate_group_from_file(std::iostream in)
+Group::generate_group_from_file(std::istream &in)
 {
-  GrpErr_t rVal = GrpErr_OK;
-  GroupError e;
-  e.set_error_code(GrpErr_UnimplimentedFunction);
-  throw e;
-  return rVal;
+  std::string line;
+  std::vector<std::string> texts;
+  uint32_t order = 0;
+  uint32_t least_order = 0;
+
+  while (std::getline(in, line))
+    {
+      size_t comment = line.find('#');
+
+      if (comment != std::string::npos)
+        {
+          line.erase(comment);
+        }
+
+      size_t first = line.find_first_not_of(" \t\r");
+      size_t last = line.find_last_not_of(" \t\r");
+
+      if (first == std::string::npos)
+        {
+          continue;
+        }
+      line = line.substr(first, last - first + 1);
+
+      if (line.compare(0, 5, "order") == 0)
+        {
+          // "order <n>" with n from 1 to max_order and nothing after it
+          const char *digits = line.c_str() + 5;
+          char *end;
+          unsigned long parsed;
+
+          if ((*digits != ' ') && (*digits != '\t'))
+            {
+              return GrpErr_ParseError;
+            }
+          parsed = strtoul(digits, &end, 10);
+          if ((end == digits) || (*end != '\0') || (parsed == 0)
+              || (parsed > max_order))
+            {
+              return GrpErr_ParseError;
+            }
+          order = parsed;
+          continue;
+        }
+
+      uint32_t fits = (line.find('(') == std::string::npos)
+        ? line.size() : cycle_text_order(line.data(), line.size());
+
+      least_order = std::max(least_order, fits);
+      texts.push_back(line);
+    }
+
+  if (texts.empty())
+    {
+      return GrpErr_ElementValueNull;
+    }
+  if (order == 0)
+    {
+      order = least_order;
+    }
+
+  std::vector<GroupElement> listed(texts.size());
+
+  for (uint32_t idx = 0; idx < texts.size(); idx++)
+    {
+      GrpErr_t rVal = parse_element_text(texts[idx], order, listed[idx]);
+
+      if (rVal != GrpErr_OK)
+        {
+          return rVal;
+        }
+    }
+  return generate(listed);
 }
 
 
@@ -347,7 +786,7 @@ GrpErr_t
 Group::is_consistent(void)
 {
   GrpErr_t rVal = GrpErr_OK;
-  std::set<GroupElement>::iterator iter;
+  ElementSet::iterator iter;
   iter = elements.begin();
   const GroupElement ident = get_identity();
 
@@ -363,22 +802,871 @@ Group::is_consistent(void)
 bool
 Group::get_element(uint32_t element_index, GroupElement &e)
 {
-  std::set<GroupElement>::iterator iter;
-  uint32_t local_index = 0;
+  build_index();
 
-  for (iter = elements.begin(); iter != elements.end(); ++iter, local_index++)
+  if (element_index >= indexed_size)
+    {
+      return false;
+    }
+  e.set_element(value_at(element_index));
+  return true;
+}
+
+GrpErr_t
+Group::set_packed_values(const char *values, uint32_t count, uint32_t order,
+                         const std::vector<GroupElement> &group_generators)
+{
+  GrpErr_t rVal = GrpErr_OK;
+  GroupElement e;
+
+  for (uint32_t idx = 0; idx < group_generators.size(); idx++)
+    {
+      if (group_generators[idx].get_order() != order)
+        {
+          return GrpErr_IncompatibleGroupElement;
+        }
+    }
+  clear();
+  for (uint32_t idx = 0; idx < count; idx++)
+    {
+      rVal = e.try_set_element(std::string(values + static_cast<size_t>(idx) * order,
+                                            order));
+      if (rVal != GrpErr_OK)
+        {
+          clear();
+          return rVal;
+        }
+      elements.insert(elements.end(), e);
+    }
+  generators = group_generators;
+  return GrpErr_OK;
+}
+
+GrpErr_t
+Group::set_generators(const std::vector<GroupElement> &group_generators)
+{
+  for (uint32_t idx = 0; idx < group_generators.size(); idx++)
     {
-      if (element_index == local_index)
+      if (group_generators[idx].get_order() != group_generators[0].get_order())
         {
-          e = *iter;
-          return true;
+          return GrpErr_IncompatibleGroupElement;
         }
     }
-  return false;
+  clear();
+  generators = group_generators;
+  return GrpErr_OK;
+}
+
+bool
+Group::multiply_indices(uint32_t lhs_index, uint32_t rhs_index,
+                        uint32_t &product_index)
+{
+  std::string product;
+
+  build_index();
+  if (lhs_index >= indexed_size || rhs_index >= indexed_size)
+    {
+      return false;
+    }
+  multiply_element_values(value_at(lhs_index),
+                          value_at(rhs_index),
+                          product);
+  return find_value(product, product_index);
+}
+
+std::string
+Group::value_at(uint32_t element_index) const
+{
+  return packed_values.substr(static_cast<size_t>(element_index) * element_order,
+                              element_order);
 }
 
 uint32_t
-Group::size(void)
+Group::get_element_order(void)
 {
-  return elements.size();
+  build_index();
+  return element_order;
+}
+
+const char *
+Group::get_packed_values(void)
+{
+  build_index();
+  return packed_values.data();
+}
+
+bool
+Group::find_element(const GroupElement &e, uint32_t &element_index)
+{
+  return find_value(e.get_element(), element_index);
+}
+
+bool
+Group::contains(const GroupElement &e)
+{
+  uint32_t element_index;
+
+  return find_value(e.get_element(), element_index);
+}
+
+void
+Group::invalidate_index(void)
+{
+  index_valid = false;
+  indexed_size = 0;
+  element_order = 0;
+  packed_values.clear();
+  rank_index.clear();
+  rank_map.clear();
+}
+
+void
+Group::build_index(void)
+{
+  if (index_valid)
+    {
+      return;
+    }
+
+  ElementSet::iterator itr;
+  uint32_t idx;
+
+  indexed_size = elements.size();
+  element_order = 0;
+  packed_values.clear();
+  rank_index.clear();
+  rank_map.clear();
+  index_valid = true;
+
+  if (indexed_size == 0)
+    {
+      return;
+    }
+
+  element_order = elements.begin()->get_order();
+  packed_values.reserve(static_cast<size_t>(indexed_size) * element_order);
+  for (itr = elements.begin(); itr != elements.end(); ++itr)
+    {
+      packed_values += itr->get_element();
+    }
+
+  uint64_t permutations = factorial(element_order);
+
+  if (permutations <= dense_rank_limit)
+    {
+      rank_index.assign(permutations, -1);
+      for (itr = elements.begin(), idx = 0; itr != elements.end(); ++itr, idx++)
+        {
+          rank_index[itr->get_rank()] = idx;
+        }
+    }
+  else
+    {
+      rank_map.reserve(indexed_size);
+      for (itr = elements.begin(), idx = 0; itr != elements.end(); ++itr, idx++)
+        {
+          rank_map[itr->get_rank()] = idx;
+        }
+    }
+}
+
+bool
+Group::find_value(const std::string &value, uint32_t &element_index)
+{
+  build_index();
+
+  if (value.size() != element_order)
+    {
+      return false;
+    }
+  return find_value(value.data(), element_index);
+}
+
+bool
+Group::find_value(const char *value, uint32_t &element_index)
+{
+  build_index();
+
+  if ((indexed_size == 0) || !is_permutation_value(value, element_order))
+    {
+      return false;
+    }
+
+  uint64_t rank = rank_element_value(value, element_order);
+
+  if (!rank_index.empty())
+    {
+      if (rank_index[rank] < 0)
+        {
+          return false;
+        }
+      element_index = rank_index[rank];
+      return true;
+    }
+
+  std::unordered_map<uint64_t, uint32_t>::const_iterator found;
+
+  found = rank_map.find(rank);
+  if (found == rank_map.end())
+    {
+      return false;
+    }
+  element_index = found->second;
+  return true;
+}
+
+// Grow the members out from the identity by right multiplication with
+// the generators
+void
+Group::closure(const std::vector<uint32_t> &generator_indices,
+               std::vector<bool> &members)
+{
+  build_index();
+  members.assign(indexed_size, false);
+
+  uint32_t identity_index;
+  std::string identity_value;
+
+  for (uint32_t i = 0; i < element_order; i++)
+    {
+      identity_value += i + '0';
+    }
+  if (!find_value(identity_value, identity_index))
+    {
+      return;
+    }
+
+  std::vector<std::string> generator_values;
+  for (uint32_t idx = 0; idx < generator_indices.size(); idx++)
+    {
+      generator_values.push_back(value_at(generator_indices[idx]));
+    }
+
+  std::deque<uint32_t> pending;
+  std::string product;
+
+  members[identity_index] = true;
+  pending.push_back(identity_index);
+  while (!pending.empty())
+    {
+      std::string value = value_at(pending.front());
+      pending.pop_front();
+
+      for (uint32_t idx = 0; idx < generator_values.size(); idx++)
+        {
+          uint32_t product_index;
+
+          multiply_element_values(value, generator_values[idx], product);
+          if (find_value(product, product_index) && !members[product_index])
+            {
+              members[product_index] = true;
+              pending.push_back(product_index);
+            }
+        }
+    }
+}
+
+const std::vector<GroupElement> &
+Group::get_generators(void)
+{
+  if (!generators.empty() || elements.size() < 2)
+    {
+      return generators;
+    }
+
+  // Greedily take the first element not yet generated
+  std::vector<uint32_t> generator_indices;
+  std::vector<bool> members;
+
+  closure(generator_indices, members);
+  for (uint32_t idx = 0; idx < indexed_size; idx++)
+    {
+      if (!members[idx])
+        {
+          generator_indices.push_back(idx);
+          GroupElement e;
+
+          e.set_element(value_at(idx));
+          generators.push_back(e);
+          closure(generator_indices, members);
+        }
+    }
+  return generators;
+}
+
+GrpErr_t
+Group::cosets(Group &H, bool left,
+              std::vector<uint32_t> &coset_ids,
+              std::vector<uint32_t> &transversal)
+{
+  const uint32_t unassigned = UINT32_MAX;
+
+  build_index();
+  H.build_index();
+  coset_ids.clear();
+  transversal.clear();
+
+  if ((H.indexed_size == 0) || (indexed_size == 0))
+    {
+      return GrpErr_ElementValueNull;
+    }
+  if (H.element_order != element_order)
+    {
+      return GrpErr_IncompatibleGroupElement;
+    }
+
+  // Each element of G is reached once, through the representative of
+  // its coset, so only |G| products are formed, a whole coset per call
+  const char *subgroup_values = H.get_packed_values();
+  std::vector<char> products(static_cast<size_t>(H.indexed_size) * element_order);
+
+  coset_ids.assign(indexed_size, unassigned);
+  for (uint32_t idx = 0; idx < indexed_size; idx++)
+    {
+      if (coset_ids[idx] != unassigned)
+        {
+          continue;
+        }
+
+      uint32_t coset = transversal.size();
+
+      transversal.push_back(idx);
+      multiply_packed_values(subgroup_values, H.indexed_size, element_order,
+                             value_at(idx),
+                             left ? GrpElDirection_left : GrpElDirection_right,
+                             products.data());
+      for (uint32_t h = 0; h < H.indexed_size; h++)
+        {
+          uint32_t product_index;
+
+          if (!find_value(&products[static_cast<size_t>(h) * element_order],
+                          product_index)
+              || (coset_ids[product_index] != unassigned
+                  && coset_ids[product_index] != coset))
+            {
+              // H is not a subgroup of this group
+              coset_ids.clear();
+              transversal.clear();
+              return GrpErr_MissingElement;
+            }
+          coset_ids[product_index] = coset;
+        }
+    }
+  return GrpErr_OK;
+}
+
+GrpErr_t
+Group::left_cosets(Group &H,
+                   std::vector<uint32_t> &coset_ids,
+                   std::vector<uint32_t> &transversal)
+{
+  return cosets(H, true, coset_ids, transversal);
+}
+
+GrpErr_t
+Group::left_cosets(Group &H, std::vector<uint32_t> &coset_ids)
+{
+  std::vector<uint32_t> transversal;
+
+  return cosets(H, true, coset_ids, transversal);
+}
+
+GrpErr_t
+Group::right_cosets(Group &H,
+                    std::vector<uint32_t> &coset_ids,
+                    std::vector<uint32_t> &transversal)
+{
+  return cosets(H, false, coset_ids, transversal);
+}
+
+GrpErr_t
+Group::right_cosets(Group &H, std::vector<uint32_t> &coset_ids)
+{
+  std::vector<uint32_t> transversal;
+
+  return cosets(H, false, coset_ids, transversal);
+}
+
+uint32_t
+Group::subgroup_index(Group &H)
+{
+  std::vector<uint32_t> coset_ids;
+  std::vector<uint32_t> transversal;
+
+  if (H.size() == 0 || (size() % H.size()) != 0)
+    {
+      return 0;
+    }
+  if (cosets(H, true, coset_ids, transversal) != GrpErr_OK)
+    {
+      return 0;
+    }
+  return transversal.size();
+}
+
+bool
+Group::is_normal(Group &H)
+{
+  const std::vector<GroupElement> &G_generators = get_generators();
+  const std::vector<GroupElement> &H_generators = H.get_generators();
+
+  build_index();
+  H.build_index();
+  if ((H.indexed_size == 0) || (indexed_size == 0)
+      || H.element_order != element_order)
+    {
+      return false;
+    }
+
+  std::string conjugate;
+  std::string product;
+  std::string inverse;
+  uint32_t element_index;
+
+  for (uint32_t h = 0; h < H_generators.size(); h++)
+    {
+      std::string h_value = H_generators[h].get_element();
+
+      if (!find_value(h_value, element_index))
+        {
+          return false;
+        }
+      for (uint32_t g = 0; g < G_generators.size(); g++)
+        {
+          std::string g_value = G_generators[g].get_element();
+
+          // g^-1 h g must stay in H
+          invert_element_value(g_value, inverse);
+          multiply_element_values(inverse, h_value, product);
+          multiply_element_values(product, g_value, conjugate);
+          if (!H.find_value(conjugate, element_index))
+            {
+              return false;
+            }
+        }
+    }
+  return true;
+}
+
+uint32_t
+Group::size(void)
+{
+  return elements.size();
+}
+
+// Set the bit for every element that commutes with value.  g x == x g
+// compares the row of x at g with the column of x at g without forming
+// either product as an element.
+void
+Group::commuting_members(const std::string &value,
+                         std::vector<uint64_t> &members)
+{
+  const uint32_t order = element_order;
+  const char *x = value.data();
+  const char *g = packed_values.data();
+
+  members.assign((indexed_size + 63) / 64, 0);
+  for (uint32_t idx = 0; idx < indexed_size; idx++, g += order)
+    {
+      bool commutes = true;
+
+      for (uint32_t i = 0; i < order; i++)
+        {
+          commutes &= (g[x[i] - '0'] == x[g[i] - '0']);
+        }
+      members[idx / 64] |= static_cast<uint64_t>(commutes) << (idx % 64);
+    }
+}
+
+void
+Group::members_to_group(const std::vector<uint64_t> &members, Group &S)
+{
+  std::vector<std::string> subgroup_values;
+  std::vector<std::string> no_generators;
+
+  for (uint32_t idx = 0; idx < indexed_size; idx++)
+    {
+      if (members[idx / 64] & (static_cast<uint64_t>(1) << (idx % 64)))
+        {
+          subgroup_values.push_back(value_at(idx));
+        }
+    }
+  // S may be this group, so it is only changed once the values are out
+  S.set_members(subgroup_values, no_generators);
+}
+
+// Z(G) is the centralizer of a generating set
+GrpErr_t
+Group::center(Group &Z)
+{
+  const std::vector<GroupElement> &G_generators = get_generators();
+  std::vector<uint64_t> members;
+  std::vector<uint64_t> commuting;
+
+  build_index();
+  if ((indexed_size == 0))
+    {
+      return GrpErr_ElementValueNull;
+    }
+
+  members.assign((indexed_size + 63) / 64, ~static_cast<uint64_t>(0));
+  for (uint32_t g = 0; g < G_generators.size(); g++)
+    {
+      commuting_members(G_generators[g].get_element(), commuting);
+      for (uint32_t word = 0; word < members.size(); word++)
+        {
+          members[word] &= commuting[word];
+        }
+    }
+  members_to_group(members, Z);
+  return GrpErr_OK;
+}
+
+GrpErr_t
+Group::centralizer(const GroupElement &e, Group &C)
+{
+  std::vector<uint64_t> members;
+
+  build_index();
+  if ((indexed_size == 0))
+    {
+      return GrpErr_ElementValueNull;
+    }
+  if (e.get_order() != element_order)
+    {
+      return GrpErr_IncompatibleGroupElement;
+    }
+
+  commuting_members(e.get_element(), members);
+  members_to_group(members, C);
+  return GrpErr_OK;
+}
+
+// g normalizes H when g^-1 h g stays in H for each generator h of H
+GrpErr_t
+Group::normalizer(Group &H, Group &N)
+{
+  build_index();
+  H.build_index();
+  if ((indexed_size == 0) || (H.indexed_size == 0))
+    {
+      return GrpErr_ElementValueNull;
+    }
+  if (H.element_order != element_order)
+    {
+      return GrpErr_IncompatibleGroupElement;
+    }
+
+  const std::vector<GroupElement> &H_generators = H.get_generators();
+  std::vector<std::string> h_values;
+  std::vector<uint64_t> members;
+  std::string g_value;
+  std::string inverse;
+  std::string product;
+  std::string conjugate;
+
+  for (uint32_t h = 0; h < H_generators.size(); h++)
+    {
+      h_values.push_back(H_generators[h].get_element());
+    }
+
+  members.assign((indexed_size + 63) / 64, 0);
+  for (uint32_t idx = 0; idx < indexed_size; idx++)
+    {
+      bool normalizes = true;
+      uint32_t h_index;
+
+      g_value.assign(packed_values, idx * element_order, element_order);
+      invert_element_value(g_value, inverse);
+      for (uint32_t h = 0; normalizes && h < h_values.size(); h++)
+        {
+          multiply_element_values(inverse, h_values[h], product);
+          multiply_element_values(product, g_value, conjugate);
+          normalizes = H.find_value(conjugate, h_index);
+        }
+      if (normalizes)
+        {
+          members[idx / 64] |= static_cast<uint64_t>(1) << (idx % 64);
+        }
+    }
+  members_to_group(members, N);
+  return GrpErr_OK;
+}
+
+// Replace the elements with the given values, which hold no duplicates
+void
+Group::set_members(std::vector<std::string> &members,
+                   const std::vector<std::string> &member_generators)
+{
+  GroupElement e;
+
+  clear();
+  std::sort(members.begin(), members.end());
+  for (size_t idx = 0; idx < members.size(); idx++)
+    {
+      e.set_element(members[idx]);
+      elements.insert(elements.end(), e);
+    }
+  for (size_t idx = 0; idx < member_generators.size(); idx++)
+    {
+      e.set_element(member_generators[idx]);
+      generators.push_back(e);
+    }
+}
+
+GrpErr_t
+Group::commutator_subgroup(Group &D)
+{
+  const std::vector<GroupElement> &G_generators = get_generators();
+  std::vector<std::string> generator_values;
+  std::vector<std::string> commutators;
+  std::vector<std::string> members;
+  std::vector<std::string> closure_generators;
+  std::string a_inverse;
+  std::string b_inverse;
+  std::string product;
+  std::string commutator;
+
+  if (G_generators.empty())
+    {
+      // The trivial group is its own commutator subgroup
+      D = *this;
+      return GrpErr_OK;
+    }
+
+  for (uint32_t idx = 0; idx < G_generators.size(); idx++)
+    {
+      generator_values.push_back(G_generators[idx].get_element());
+    }
+
+  // [a,b] = a^-1 b^-1 a b over pairs of generators
+  for (uint32_t a = 0; a < generator_values.size(); a++)
+    {
+      invert_element_value(generator_values[a], a_inverse);
+      for (uint32_t b = a + 1; b < generator_values.size(); b++)
+        {
+          invert_element_value(generator_values[b], b_inverse);
+          multiply_element_values(a_inverse, b_inverse, product);
+          multiply_element_values(product, generator_values[a], commutator);
+          multiply_element_values(commutator, generator_values[b], product);
+          commutators.push_back(product);
+        }
+    }
+
+  // Seed with the identity so an abelian group still gives the trivial
+  // group of the right order
+  std::string identity_value;
+  for (uint32_t i = 0; i < generator_values[0].size(); i++)
+    {
+      identity_value += i + '0';
+    }
+  commutators.push_back(identity_value);
+
+  normal_closure(commutators, generator_values, members, closure_generators);
+  D.set_members(members, closure_generators);
+  return GrpErr_OK;
+}
+
+GrpErr_t
+Group::derived_series(std::vector<Group> &series)
+{
+  GrpErr_t rVal = GrpErr_OK;
+  Group D;
+
+  series.clear();
+  if (elements.empty() && generators.empty())
+    {
+      return GrpErr_ElementValueNull;
+    }
+  series.push_back(*this);
+
+  // A group given only by generators has no size yet, so its first
+  // commutator subgroup is always kept
+  uint32_t previous_size = size();
+
+  while (previous_size != 1)
+    {
+      if ((rVal = series.back().commutator_subgroup(D)) != GrpErr_OK)
+        {
+          return rVal;
+        }
+      if (D.size() == previous_size)
+        {
+          break;
+        }
+      previous_size = D.size();
+      series.push_back(D);
+    }
+  return rVal;
+}
+
+bool
+Group::is_solvable(void)
+{
+  std::vector<Group> series;
+
+  if (derived_series(series) != GrpErr_OK)
+    {
+      return false;
+    }
+  return series.back().size() <= 1;
+}
+
+uint32_t
+Group::degree(void)
+{
+  const std::vector<GroupElement> &group_generators = get_generators();
+
+  if (!group_generators.empty())
+    {
+      return group_generators[0].get_order();
+    }
+  return get_element_order();
+}
+
+bool
+Group::is_transitive(void)
+{
+  const std::vector<GroupElement> &group_generators = get_generators();
+  uint32_t points = degree();
+  uint32_t reached = 1;
+  std::vector<uint32_t> orbit(1, 0);
+
+  if (points <= 1)
+    {
+      return points == 1;
+    }
+
+  // The orbit of point 0 as a bitmask, the degree being at most 16
+  for (uint32_t idx = 0; idx < orbit.size(); idx++)
+    {
+      for (uint32_t g = 0; g < group_generators.size(); g++)
+        {
+          uint32_t image = group_generators[g].get_element()[orbit[idx]] - '0';
+
+          if ((reached & (1u << image)) == 0)
+            {
+              reached |= 1u << image;
+              orbit.push_back(image);
+            }
+        }
+    }
+  return orbit.size() == points;
+}
+
+// Atkinson's algorithm: whenever two classes are joined, the images of
+// the pair under every generator must be joined as well.  At most n - 1
+// joins happen, so at most n pairs are ever looked at.
+GrpErr_t
+Group::minimal_blocks(uint32_t a, uint32_t b, std::vector<uint32_t> &block_ids)
+{
+  uint32_t points = degree();
+
+  if (a >= points || b >= points)
+    {
+      return GrpErr_IndexOutOfBounds;
+    }
+
+  std::vector<std::string> values;
+  std::vector<uint32_t> parents(points);
+  std::deque<std::pair<uint32_t, uint32_t> > pairs;
+
+  for (uint32_t g = 0; g < get_generators().size(); g++)
+    {
+      values.push_back(get_generators()[g].get_element());
+    }
+  for (uint32_t p = 0; p < points; p++)
+    {
+      parents[p] = p;
+    }
+
+  pairs.push_back(std::make_pair(a, b));
+  while (!pairs.empty())
+    {
+      uint32_t x = pairs.front().first;
+      uint32_t y = pairs.front().second;
+
+      pairs.pop_front();
+      while (parents[x] != x)
+        {
+          x = parents[x];
+        }
+      while (parents[y] != y)
+        {
+          y = parents[y];
+        }
+      if (x == y)
+        {
+          continue;
+        }
+      parents[std::max(x, y)] = std::min(x, y);
+      for (uint32_t g = 0; g < values.size(); g++)
+        {
+          pairs.push_back(std::make_pair(values[g][x] - '0', values[g][y] - '0'));
+        }
+    }
+
+  // Roots are the smallest points of their blocks
+  block_ids.assign(points, 0);
+  uint32_t blocks = 0;
+
+  for (uint32_t p = 0; p < points; p++)
+    {
+      uint32_t root = p;
+
+      while (parents[root] != root)
+        {
+          root = parents[root];
+        }
+      block_ids[p] = (root == p) ? blocks++ : block_ids[root];
+    }
+  return GrpErr_OK;
+}
+
+GrpErr_t
+Group::minimal_block_system(std::vector<uint32_t> &block_ids)
+{
+  uint32_t points = degree();
+
+  if (!is_transitive())
+    {
+      return GrpErr_NotTransitive;
+    }
+
+  // Every block system has a block holding 0 and some other point b,
+  // so the smallest blocks are among those of the pairs {0, b}
+  uint32_t best_size = points;
+  std::vector<uint32_t> blocks;
+
+  block_ids.resize(points);
+  for (uint32_t p = 0; p < points; p++)
+    {
+      block_ids[p] = p;
+    }
+  for (uint32_t b = 1; b < points; b++)
+    {
+      minimal_blocks(0, b, blocks);
+
+      uint32_t block_size = std::count(blocks.begin(), blocks.end(), 0u);
+
+      if (block_size < best_size)
+        {
+          best_size = block_size;
+          block_ids = blocks;
+        }
+    }
+  return GrpErr_OK;
+}
+
+bool
+Group::is_primitive(void)
+{
+  std::vector<uint32_t> block_ids;
+
+  if (minimal_block_system(block_ids) != GrpErr_OK)
+    {
+      return false;
+    }
+  // Single points when no pair {0, b} lies in a proper block
+  return block_ids.back() == block_ids.size() - 1;
 }
@@ -30,6 +30,12 @@
 #include <stdint.h>
 
 #include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ElementArena.h"
+#include "GroupElement.h"
 
 // The various means by which we may flesh out a group
 typedef enum
@@ -53,7 +59,7 @@ class Group
 
   friend std::ostream &operator <<(std::ostream &output, Group &G)
   {
-    std::set<GroupElement>::iterator itr;
+    ElementSet::iterator itr;
 
     for (itr = G.elements.begin(); itr != G.elements.end(); ++itr)
       {
@@ -75,6 +81,18 @@ class Group
   // Generate a cyclic group based on the element e
   GrpErr_t generate(GroupElement &e);
 
+  // Generate the closure of the given generators
+  GrpErr_t generate(const std::vector<GroupElement> &group_generators);
+
+  // Adds the generator g to this group, which must be closed, and closes
+  // it again Dimino style.  The group grows by whole cosets H r of the old
+  // group H, each made in one batch from H's packed values, and only the
+  // coset representatives are multiplied by the generators.  added is the
+  // number of new elements, 0 when g was already in the group, and the
+  // group grew by the factor size() / (size() - added).  An empty group
+  // starts as the trivial group.
+  GrpErr_t add_generator(const GroupElement &g, uint32_t &added);
+
   // Generate the full permutation group
   void permute(std::string a, int32_t l, int32_t r);
   GrpErr_t generate_Sn(uint32_t order);
@@ -88,7 +106,10 @@ class Group
   // Generate the polygon rotational group
   GrpErr_t generate_Cn(uint32_t vertices);
 
-  GrpErr_t generate_group_from_file(std::iostream in);
+  // The group generated by the elements listed one per line, in cycle
+  // notation or as digit strings.  A line "order <n>" sets the order,
+  // otherwise it is the least the elements fit, and # starts a comment.
+  GrpErr_t generate_group_from_file(std::istream &in);
 
   // Internal consistency check
   GrpErr_t is_consistent();
@@ -96,6 +117,95 @@ class Group
   // Element is returned in the reference
   bool get_element(uint32_t element_index, GroupElement &e);
 
+  // Cayley table entry for the elements at the given indices
+  bool multiply_indices(uint32_t lhs_index, uint32_t rhs_index,
+                        uint32_t &product_index);
+
+  // The order of the elements, 0 for an empty group
+  uint32_t get_element_order(void);
+
+  // The element values back to back in index order, get_element_order()
+  // characters each.  Valid until the group is next changed.
+  const char *get_packed_values(void);
+
+  // Replaces the elements by count values of the given order packed as
+  // by get_packed_values, and the generators by group_generators.  Values
+  // already in index order, as saved from get_packed_values, are inserted
+  // in linear time.  The group is left empty if a value is not an element.
+  // Repeated values are kept once, so size() may be less than count.
+  GrpErr_t set_packed_values(const char *values, uint32_t count, uint32_t order,
+                             const std::vector<GroupElement> &group_generators);
+
+  // The index of e as used by get_element, found through its rank
+  bool find_element(const GroupElement &e, uint32_t &element_index);
+  // The same for a raw element value, as from get_packed_values.  A
+  // value that is not a permutation of the group's order is not found.
+  bool find_value(const std::string &value, uint32_t &element_index);
+  // value holds get_element_order() characters, e.g. one packed product,
+  // and is checked the same way
+  bool find_value(const char *value, uint32_t &element_index);
+  bool contains(const GroupElement &e);
+
+  // Generators recorded by the generate_* methods, otherwise a
+  // generating set is picked from the elements on demand
+  const std::vector<GroupElement> &get_generators(void);
+
+  // Describe the group by its generators alone, leaving the elements
+  // unmaterialized
+  GrpErr_t set_generators(const std::vector<GroupElement> &group_generators);
+
+  // Coset decomposition by the subgroup H.  coset_ids[i] is the coset
+  // holding element i of this group, numbered by their first element so
+  // H itself is coset 0.  transversal[c] is the element index of the
+  // representative for coset c.
+  GrpErr_t left_cosets(Group &H,
+                       std::vector<uint32_t> &coset_ids,
+                       std::vector<uint32_t> &transversal);
+  GrpErr_t left_cosets(Group &H, std::vector<uint32_t> &coset_ids);
+  GrpErr_t right_cosets(Group &H,
+                        std::vector<uint32_t> &coset_ids,
+                        std::vector<uint32_t> &transversal);
+  GrpErr_t right_cosets(Group &H, std::vector<uint32_t> &coset_ids);
+
+  // [G:H], 0 if H is not a subgroup of this group
+  uint32_t subgroup_index(Group &H);
+
+  // Conjugates the generators of H by the generators of this group
+  bool is_normal(Group &H);
+
+  // Subgroups found by bitset membership over the element indices.
+  // The previous contents of the result group are replaced.
+  GrpErr_t center(Group &Z);
+  GrpErr_t centralizer(const GroupElement &e, Group &C);
+  GrpErr_t normalizer(Group &H, Group &N);
+
+  // [G,G] as the normal closure of the commutators of the generators.
+  // Only the generators are used so this also works on groups given by
+  // set_generators.
+  GrpErr_t commutator_subgroup(Group &D);
+
+  // G = G(0) > G(1) > ... with G(i+1) = [G(i),G(i)], ending at the first
+  // term equal to its own commutator subgroup.  GrpErr_ElementValueNull,
+  // and not solvable, for a group with neither elements nor generators.
+  GrpErr_t derived_series(std::vector<Group> &series);
+  bool is_solvable(void);
+
+  // The group as permutations of the points 0 .. n-1.  Only the
+  // generators are used, so these also work on groups given by
+  // set_generators and cost about n times the generator count.
+  bool is_transitive(void);
+  // Transitive with no blocks but the single points and the whole set
+  bool is_primitive(void);
+  // The finest block system with a and b in one block, joining the
+  // images of joined points under each generator.  block_ids[p] numbers
+  // the block of p, counting blocks in order of their smallest point.
+  GrpErr_t minimal_blocks(uint32_t a, uint32_t b,
+                          std::vector<uint32_t> &block_ids);
+  // A block system whose blocks are the smallest above single points,
+  // all single points when the group is primitive.
+  // GrpErr_NotTransitive when the group is not transitive.
+  GrpErr_t minimal_block_system(std::vector<uint32_t> &block_ids);
+
   // The number of elements currently in the group
   // The group need not represent a full group
   // I.e. elements may be missing if building up the group
@@ -107,7 +217,42 @@ class Group
 
   GroupElement identity;
 
-  std::set<GroupElement> elements;
+  // Elements live in a per-group arena so a large group is a handful of
+  // slabs rather than one heap block per element
+  typedef std::set<GroupElement, std::less<GroupElement>,
+                   ArenaAllocator<GroupElement> > ElementSet;
+
+  ElementSet elements;
+
+  std::vector<GroupElement> generators;
+
+  // Element index built on demand from the ordered set.  Ranks map to
+  // element indices through a dense table when order! is small enough
+  // and a hash otherwise.
+  void build_index(void);
+  void invalidate_index(void);
+  // The value of an indexed element, from the packed values
+  std::string value_at(uint32_t element_index) const;
+  GrpErr_t cosets(Group &H, bool left,
+                  std::vector<uint32_t> &coset_ids,
+                  std::vector<uint32_t> &transversal);
+  void closure(const std::vector<uint32_t> &generator_indices,
+               std::vector<bool> &members);
+  void commuting_members(const std::string &value,
+                         std::vector<uint64_t> &members);
+  void members_to_group(const std::vector<uint64_t> &members, Group &S);
+  void set_members(std::vector<std::string> &members,
+                   const std::vector<std::string> &member_generators);
+  // The number of points the group permutes
+  uint32_t degree(void);
+
+  bool index_valid;
+  uint32_t indexed_size;
+  // The element values back to back, element_order characters each
+  uint32_t element_order;
+  std::string packed_values;
+  std::vector<int32_t> rank_index;
+  std::unordered_map<uint64_t, uint32_t> rank_map;
 };
 
 // The various generator functions
@@ -0,0 +1,458 @@
+/******************************************************************************/
+/*                                                                            */
+/*  GroupAction.cpp: Orbits of a group on points, tuples and subsets          */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+#include "Factorization.h"
+#include "GroupAction.h"
+
+// Longest tuple an action can have, 2^31 codes of at least two points
+const uint32_t max_action_tuple = 31;
+
+// Parents always point to smaller codes, so each root is the smallest
+// code of its set.  Path halving keeps the trees shallow.
+static uint32_t
+find_root(std::vector<uint32_t> &parents, uint32_t code)
+{
+  while (parents[code] != code)
+    {
+      parents[code] = parents[parents[code]];
+      code = parents[code];
+    }
+  return code;
+}
+
+static void
+join(std::vector<uint32_t> &parents, uint32_t a, uint32_t b)
+{
+  a = find_root(parents, a);
+  b = find_root(parents, b);
+  if (a < b)
+    {
+      parents[b] = a;
+    }
+  else if (b < a)
+    {
+      parents[a] = b;
+    }
+}
+
+GroupAction::GroupAction()
+{
+  clear();
+}
+
+GroupAction::~GroupAction()
+{
+}
+
+void
+GroupAction::clear(void)
+{
+  action_type = GrpAction_Points;
+  element_order = 0;
+  tuple_length = 0;
+  code_count = 0;
+  group_order = 0;
+  binomials.clear();
+  orbit_ids.clear();
+  orbit_sizes.clear();
+  representatives.clear();
+}
+
+GrpErr_t
+GroupAction::set_action(uint32_t order, GrpAction_t action, uint32_t k)
+{
+  if (order == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+
+  binomials.assign(order + 1, std::vector<uint64_t>(order + 1, 0));
+  for (uint32_t n = 0; n <= order; n++)
+    {
+      binomials[n][0] = 1;
+      for (uint32_t r = 1; r <= n; r++)
+        {
+          binomials[n][r] = binomials[n - 1][r - 1] + (r < n ? binomials[n - 1][r] : 0);
+        }
+    }
+
+  switch (action)
+    {
+    case GrpAction_Points:
+      k = 1;
+      code_count = order;
+      break;
+
+    case GrpAction_Tuples:
+      if (k > max_action_tuple)
+        {
+          return GrpErr_ElementOverflow;
+        }
+      code_count = 1;
+      for (uint32_t i = 0; i < k; i++)
+        {
+          code_count *= order;
+          if (code_count > max_action_size)
+            {
+              return GrpErr_ElementOverflow;
+            }
+        }
+      break;
+
+    case GrpAction_Subsets:
+      if (k > order)
+        {
+          return GrpErr_IndexOutOfBounds;
+        }
+      code_count = binomials[order][k];
+      if (code_count > max_action_size)
+        {
+          return GrpErr_ElementOverflow;
+        }
+      break;
+
+    default:
+      return GrpErr_UnimplimentedFunction;
+    }
+
+  action_type = action;
+  element_order = order;
+  tuple_length = k;
+  return GrpErr_OK;
+}
+
+GrpErr_t
+GroupAction::generate(const std::vector<GroupElement> &generators,
+                      GrpAction_t action, uint32_t k)
+{
+  clear();
+
+  if (generators.empty())
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  for (uint32_t idx = 1; idx < generators.size(); idx++)
+    {
+      if (generators[idx].get_order() != generators[0].get_order())
+        {
+          return GrpErr_OrderMismatch;
+        }
+    }
+
+  GrpErr_t result = set_action(generators[0].get_order(), action, k);
+
+  if (result != GrpErr_OK)
+    {
+      clear();
+      return result;
+    }
+
+  FactorizationChain chain;
+
+  result = chain.generate(generators, false);
+  if (result != GrpErr_OK)
+    {
+      clear();
+      return result;
+    }
+  group_order = chain.size();
+  find_orbits(generators);
+  return GrpErr_OK;
+}
+
+GrpErr_t
+GroupAction::generate(Group &G, GrpAction_t action, uint32_t k)
+{
+  clear();
+
+  if (G.size() == 0)
+    {
+      return GrpErr_ElementValueNull;
+    }
+
+  GrpErr_t result = set_action(G.get_element_order(), action, k);
+
+  if (result != GrpErr_OK)
+    {
+      clear();
+      return result;
+    }
+  group_order = G.size();
+  find_orbits(G.get_generators());
+  return GrpErr_OK;
+}
+
+void
+GroupAction::find_orbits(const std::vector<GroupElement> &generators)
+{
+  std::vector<uint32_t> &parents = orbit_ids;
+  std::vector<std::string> values;
+
+  for (uint32_t g = 0; g < generators.size(); g++)
+    {
+      values.push_back(generators[g].get_element());
+    }
+
+  parents.resize(code_count);
+  for (uint64_t code = 0; code < code_count; code++)
+    {
+      parents[code] = code;
+    }
+
+  if (action_type == GrpAction_Subsets && tuple_length > 0)
+    {
+      // Colex order is the order of the masks, which Gosper's hack walks
+      uint32_t mask = (1u << tuple_length) - 1;
+
+      for (uint64_t code = 0; code < code_count; code++)
+        {
+          for (uint32_t g = 0; g < values.size(); g++)
+            {
+              uint32_t moved = 0;
+
+              for (uint32_t bits = mask; bits != 0; bits &= bits - 1)
+                {
+                  moved |= 1u << (values[g][__builtin_ctz(bits)] - '0');
+                }
+              join(parents, code, subset_rank(moved));
+            }
+
+          uint32_t low = mask & -mask;
+          uint32_t ripple = mask + low;
+
+          mask = ripple | (((mask ^ ripple) >> 2) / low);
+        }
+    }
+  else if (action_type == GrpAction_Tuples)
+    {
+      // The digits of the code count up like an odometer
+      uint32_t digits[max_action_tuple] = {0};
+
+      for (uint64_t code = 0; code < code_count; code++)
+        {
+          for (uint32_t g = 0; g < values.size(); g++)
+            {
+              uint64_t moved = 0;
+
+              for (uint32_t i = tuple_length; i-- > 0; )
+                {
+                  moved = moved * element_order + (values[g][digits[i]] - '0');
+                }
+              join(parents, code, moved);
+            }
+          for (uint32_t i = 0; i < tuple_length && ++digits[i] == element_order; i++)
+            {
+              digits[i] = 0;
+            }
+        }
+    }
+  else if (action_type == GrpAction_Points)
+    {
+      for (uint64_t code = 0; code < code_count; code++)
+        {
+          for (uint32_t g = 0; g < values.size(); g++)
+            {
+              join(parents, code, values[g][code] - '0');
+            }
+        }
+    }
+
+  // Roots first become their smallest code, then an orbit number given
+  // in order of those codes
+  for (uint64_t code = 0; code < code_count; code++)
+    {
+      parents[code] = parents[parents[code]];
+    }
+  for (uint64_t code = 0; code < code_count; code++)
+    {
+      if (parents[code] == code)
+        {
+          parents[code] = orbit_sizes.size();
+          orbit_sizes.push_back(0);
+          representatives.push_back(code);
+        }
+      else
+        {
+          parents[code] = parents[parents[code]];
+        }
+      orbit_sizes[parents[code]]++;
+    }
+}
+
+uint64_t
+GroupAction::subset_rank(uint32_t mask) const
+{
+  uint64_t rank = 0;
+
+  for (uint32_t i = 1; mask != 0; i++, mask &= mask - 1)
+    {
+      rank += binomials[__builtin_ctz(mask)][i];
+    }
+  return rank;
+}
+
+uint64_t
+GroupAction::size(void) const
+{
+  return code_count;
+}
+
+uint64_t
+GroupAction::group_size(void) const
+{
+  return group_order;
+}
+
+GrpErr_t
+GroupAction::encode(const std::vector<uint32_t> &points, uint64_t &code) const
+{
+  if (points.size() != tuple_length)
+    {
+      return GrpErr_IndexOutOfBounds;
+    }
+
+  uint32_t mask = 0;
+
+  code = 0;
+  for (uint32_t i = tuple_length; i-- > 0; )
+    {
+      if (points[i] >= element_order)
+        {
+          return GrpErr_ElementValueOutOfRange;
+        }
+      if (mask & (1u << points[i]))
+        {
+          if (action_type == GrpAction_Subsets)
+            {
+              return GrpErr_ElementValueDuplicated;
+            }
+        }
+      mask |= 1u << points[i];
+      code = code * element_order + points[i];
+    }
+  if (action_type == GrpAction_Subsets)
+    {
+      code = subset_rank(mask);
+    }
+  return GrpErr_OK;
+}
+
+void
+GroupAction::decode(uint64_t code, std::vector<uint32_t> &points) const
+{
+  points.resize(tuple_length);
+  if (action_type != GrpAction_Subsets)
+    {
+      for (uint32_t i = 0; i < tuple_length; i++)
+        {
+          points[i] = code % element_order;
+          code /= element_order;
+        }
+      return;
+    }
+
+  // The largest point c with C(c, i) <= code, for i = k down to 1
+  uint32_t c = element_order;
+
+  for (uint32_t i = tuple_length; i > 0; i--)
+    {
+      do
+        {
+          c--;
+        } while (binomials[c][i] > code);
+      points[i - 1] = c;
+      code -= binomials[c][i];
+    }
+}
+
+uint64_t
+GroupAction::image(uint64_t code, const std::string &element_value) const
+{
+  if (action_type == GrpAction_Points)
+    {
+      return element_value[code] - '0';
+    }
+
+  std::vector<uint32_t> points;
+  uint64_t moved = 0;
+
+  decode(code, points);
+  if (action_type == GrpAction_Subsets)
+    {
+      uint32_t mask = 0;
+
+      for (uint32_t i = 0; i < tuple_length; i++)
+        {
+          mask |= 1u << (element_value[points[i]] - '0');
+        }
+      return subset_rank(mask);
+    }
+  for (uint32_t i = tuple_length; i-- > 0; )
+    {
+      moved = moved * element_order + (element_value[points[i]] - '0');
+    }
+  return moved;
+}
+
+uint32_t
+GroupAction::orbit_count(void) const
+{
+  return orbit_sizes.size();
+}
+
+const std::vector<uint32_t> &
+GroupAction::get_orbit_ids(void) const
+{
+  return orbit_ids;
+}
+
+const std::vector<uint64_t> &
+GroupAction::get_orbit_sizes(void) const
+{
+  return orbit_sizes;
+}
+
+const std::vector<uint64_t> &
+GroupAction::get_representatives(void) const
+{
+  return representatives;
+}
+
+uint64_t
+GroupAction::stabilizer_size(uint64_t code) const
+{
+  if (code >= code_count)
+    {
+      throw GroupError(GrpErr_IndexOutOfBounds);
+    }
+  return group_order / orbit_sizes[orbit_ids[code]];
+}
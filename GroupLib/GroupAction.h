@@ -0,0 +1,102 @@
+/******************************************************************************/
+/*                                                                            */
+/*  GroupAction.h Orbits of a group on points, tuples and subsets             */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef GROUP_ACTION_H__
+#define GROUP_ACTION_H__
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+
+// What the group acts on, each encoded as an integer code
+typedef enum
+  {
+    GrpAction_Points,   // 0 .. n-1, the point itself
+    GrpAction_Tuples,   // (p0, ..., pk-1) as p0 + p1 n + ... + pk-1 n^(k-1)
+    GrpAction_Subsets,  // k-subsets by their colex rank, the order of their bitmasks
+    GrpAction_MaxAction
+  } GrpAction_t;
+
+// Most codes an action may have
+const uint64_t max_action_size = 1ull << 31;
+
+// The orbits of a group acting on points, k-tuples or k-subsets, found
+// by joining each code to its images under the generators with a
+// union-find.  Memory follows the number of codes, not the group.
+// Stabilizer sizes come from |G| / |orbit|, taking |G| from the Group
+// or, given only generators, from a stabilizer chain.
+class GroupAction
+{
+ public:
+  GroupAction();
+  ~GroupAction();
+
+  GrpErr_t generate(const std::vector<GroupElement> &generators,
+                    GrpAction_t action, uint32_t k = 1);
+  GrpErr_t generate(Group &G, GrpAction_t action, uint32_t k = 1);
+  void clear(void);
+
+  // The number of codes acted on
+  uint64_t size(void) const;
+  uint64_t group_size(void) const;
+
+  // The code of the points, which must be distinct for subsets
+  GrpErr_t encode(const std::vector<uint32_t> &points, uint64_t &code) const;
+  void decode(uint64_t code, std::vector<uint32_t> &points) const;
+  // The image of a code under an element of the group's order
+  uint64_t image(uint64_t code, const std::string &element_value) const;
+
+  uint32_t orbit_count(void) const;
+  // Orbits are numbered by their smallest code
+  const std::vector<uint32_t> &get_orbit_ids(void) const;
+  const std::vector<uint64_t> &get_orbit_sizes(void) const;
+  // The smallest code in each orbit
+  const std::vector<uint64_t> &get_representatives(void) const;
+  uint64_t stabilizer_size(uint64_t code) const;
+
+ private:
+  GrpErr_t set_action(uint32_t order, GrpAction_t action, uint32_t k);
+  void find_orbits(const std::vector<GroupElement> &generators);
+  uint64_t subset_rank(uint32_t mask) const;
+
+  GrpAction_t action_type;
+  uint32_t element_order;
+  uint32_t tuple_length;
+  uint64_t code_count;
+  uint64_t group_order;
+  // binomials[n][k] for the subset ranks
+  std::vector<std::vector<uint64_t> > binomials;
+
+  std::vector<uint32_t> orbit_ids;
+  std::vector<uint64_t> orbit_sizes;
+  std::vector<uint64_t> representatives;
+};
+
+#endif // GROUP_ACTION_H__
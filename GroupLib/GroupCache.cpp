@@ -0,0 +1,422 @@
+/******************************************************************************/
+/*                                                                            */
+/*  GroupCache.cpp: Generated groups kept by a canonical key                  */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "GroupCache.h"
+
+const char group_cache_magic[8] = {'G', 'R', 'P', 'C', 'A', 'C', 'H', '1'};
+
+GroupCache::GroupCache(size_t capacity, const std::string &directory)
+  : capacity(capacity), directory(directory), hits(0), disk_hits(0), misses(0)
+{
+}
+
+GroupCache::~GroupCache()
+{
+}
+
+GrpErr_t
+GroupCache::generate(GrpGen_t type, uint32_t parameter, std::shared_ptr<Group> &G)
+{
+  GrpErr_t rVal = GrpErr_OK;
+  std::string group_key = key(type, parameter);
+
+  if (group_key.empty())
+    {
+      return GrpErr_UnimplimentedFunction;
+    }
+  if (find(group_key, G))
+    {
+      return GrpErr_OK;
+    }
+
+  std::shared_ptr<Group> made = std::make_shared<Group>();
+
+  switch (type)
+    {
+    case GrpGen_Sn:
+      rVal = made->generate_Sn(parameter);
+      break;
+    case GrpGen_An:
+      rVal = made->generate_An(parameter);
+      break;
+    case GrpGen_Dn:
+      rVal = made->generate_Dn(parameter);
+      break;
+    default:
+      rVal = made->generate_Cn(parameter);
+      break;
+    }
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+  if (!directory.empty())
+    {
+      // The cache still works without its directory
+      save(group_key, *made);
+    }
+  insert(group_key, made);
+  G = made;
+  return GrpErr_OK;
+}
+
+GrpErr_t
+GroupCache::generate(const std::vector<GroupElement> &group_generators,
+                     std::shared_ptr<Group> &G)
+{
+  if (group_generators.empty())
+    {
+      return GrpErr_ElementValueNull;
+    }
+  for (uint32_t idx = 0; idx < group_generators.size(); idx++)
+    {
+      if (group_generators[idx].get_order() != group_generators[0].get_order())
+        {
+          return GrpErr_IncompatibleGroupElement;
+        }
+    }
+
+  std::string group_key = key(group_generators);
+
+  if (find(group_key, G))
+    {
+      return GrpErr_OK;
+    }
+
+  std::shared_ptr<Group> made = std::make_shared<Group>();
+  GrpErr_t rVal = made->generate(group_generators);
+
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+  if (!directory.empty())
+    {
+      save(group_key, *made);
+    }
+  insert(group_key, made);
+  G = made;
+  return GrpErr_OK;
+}
+
+std::string
+GroupCache::key(GrpGen_t type, uint32_t parameter)
+{
+  switch (type)
+    {
+    case GrpGen_Sn:
+      return "Sn " + std::to_string(parameter);
+    case GrpGen_An:
+      return "An " + std::to_string(parameter);
+    case GrpGen_Dn:
+      return "Dn " + std::to_string(parameter);
+    case GrpGen_Cn:
+      return "Cn " + std::to_string(parameter);
+    default:
+      // The others have no single parameter
+      return "";
+    }
+}
+
+std::string
+GroupCache::key(const std::vector<GroupElement> &group_generators)
+{
+  std::vector<std::string> values;
+  std::string group_key;
+
+  for (uint32_t idx = 0; idx < group_generators.size(); idx++)
+    {
+      values.push_back(group_generators[idx].get_element());
+    }
+  std::sort(values.begin(), values.end());
+  values.erase(std::unique(values.begin(), values.end()), values.end());
+
+  group_key = std::to_string(values.empty() ? 0 : values[0].size()) + ":";
+  for (size_t idx = 0; idx < values.size(); idx++)
+    {
+      group_key += " " + values[idx];
+    }
+  return group_key;
+}
+
+void
+GroupCache::clear(void)
+{
+  std::lock_guard<std::mutex> guard(lock);
+
+  entries.clear();
+  lookup.clear();
+}
+
+size_t
+GroupCache::size(void)
+{
+  std::lock_guard<std::mutex> guard(lock);
+
+  return entries.size();
+}
+
+uint64_t
+GroupCache::get_hits(void)
+{
+  std::lock_guard<std::mutex> guard(lock);
+
+  return hits;
+}
+
+uint64_t
+GroupCache::get_disk_hits(void)
+{
+  std::lock_guard<std::mutex> guard(lock);
+
+  return disk_hits;
+}
+
+uint64_t
+GroupCache::get_misses(void)
+{
+  std::lock_guard<std::mutex> guard(lock);
+
+  return misses;
+}
+
+bool
+GroupCache::find(const std::string &group_key, std::shared_ptr<Group> &G)
+{
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    std::unordered_map<std::string, EntryList::iterator>::iterator found;
+
+    found = lookup.find(group_key);
+    if (found != lookup.end())
+      {
+        entries.splice(entries.begin(), entries, found->second);
+        G = found->second->second;
+        hits++;
+        return true;
+      }
+  }
+
+  // Files are read outside the lock
+  std::shared_ptr<Group> loaded;
+
+  if (!directory.empty() && (load(group_key, loaded) == GrpErr_OK))
+    {
+      insert(group_key, loaded);
+      G = loaded;
+
+      std::lock_guard<std::mutex> guard(lock);
+
+      disk_hits++;
+      return true;
+    }
+
+  std::lock_guard<std::mutex> guard(lock);
+
+  misses++;
+  return false;
+}
+
+void
+GroupCache::insert(const std::string &group_key, std::shared_ptr<Group> &G)
+{
+  // Build the index and the generators now so sharing readers never
+  // change the group
+  G->get_packed_values();
+  G->get_generators();
+
+  std::lock_guard<std::mutex> guard(lock);
+  std::unordered_map<std::string, EntryList::iterator>::iterator found;
+
+  found = lookup.find(group_key);
+  if (found != lookup.end())
+    {
+      entries.splice(entries.begin(), entries, found->second);
+      G = found->second->second;
+      return;
+    }
+  if (capacity == 0)
+    {
+      return;
+    }
+  if (entries.size() == capacity)
+    {
+      lookup.erase(entries.back().first);
+      entries.pop_back();
+    }
+  entries.push_front(std::make_pair(group_key, G));
+  lookup[group_key] = entries.begin();
+}
+
+// FNV-1a of the key; the key saved in the file settles any collision
+std::string
+GroupCache::file_name(const std::string &group_key) const
+{
+  uint64_t hash = 14695981039346656037ULL;
+  char name[32];
+
+  for (size_t idx = 0; idx < group_key.size(); idx++)
+    {
+      hash ^= static_cast<uint8_t>(group_key[idx]);
+      hash *= 1099511628211ULL;
+    }
+  snprintf(name, sizeof(name), "%016llx.grp", static_cast<unsigned long long>(hash));
+  return directory + "/" + name;
+}
+
+GrpErr_t
+GroupCache::save(const std::string &group_key, Group &G)
+{
+  std::string group_file = file_name(group_key);
+  std::string temporary = group_file + ".tmp";
+  std::ofstream out(temporary.c_str(), std::ios::binary | std::ios::trunc);
+  const std::vector<GroupElement> &group_generators = G.get_generators();
+  uint32_t key_length = group_key.size();
+  uint32_t order = G.get_element_order();
+  uint32_t group_size = G.size();
+  uint32_t generator_count = group_generators.size();
+
+  out.write(group_cache_magic, sizeof(group_cache_magic));
+  out.write(reinterpret_cast<const char *>(&key_length), sizeof(key_length));
+  out.write(group_key.data(), key_length);
+  out.write(reinterpret_cast<const char *>(&order), sizeof(order));
+  out.write(reinterpret_cast<const char *>(&group_size), sizeof(group_size));
+  out.write(reinterpret_cast<const char *>(&generator_count), sizeof(generator_count));
+  for (uint32_t idx = 0; idx < generator_count; idx++)
+    {
+      out.write(group_generators[idx].get_element().data(), order);
+    }
+  out.write(G.get_packed_values(), static_cast<std::streamsize>(group_size) * order);
+  out.close();
+
+  if (!out || rename(temporary.c_str(), group_file.c_str()) != 0)
+    {
+      remove(temporary.c_str());
+      return GrpErr_FileAccess;
+    }
+  return GrpErr_OK;
+}
+
+GrpErr_t
+GroupCache::load(const std::string &group_key, std::shared_ptr<Group> &G)
+{
+  std::ifstream in(file_name(group_key).c_str(), std::ios::binary);
+  char magic[sizeof(group_cache_magic)];
+  uint32_t key_length = 0;
+  uint32_t order = 0;
+  uint32_t group_size = 0;
+  uint32_t generator_count = 0;
+
+  if (!in)
+    {
+      return GrpErr_FileAccess;
+    }
+
+  in.read(magic, sizeof(magic));
+  in.read(reinterpret_cast<char *>(&key_length), sizeof(key_length));
+  if (!in || (memcmp(magic, group_cache_magic, sizeof(magic)) != 0)
+      || (key_length != group_key.size()))
+    {
+      return GrpErr_CheckpointMismatch;
+    }
+
+  std::string saved_key(key_length, '\0');
+
+  in.read(&saved_key[0], key_length);
+  in.read(reinterpret_cast<char *>(&order), sizeof(order));
+  in.read(reinterpret_cast<char *>(&group_size), sizeof(group_size));
+  in.read(reinterpret_cast<char *>(&generator_count), sizeof(generator_count));
+  if (!in)
+    {
+      return GrpErr_FileAccess;
+    }
+  if ((saved_key != group_key) || (order == 0) || (order > max_order)
+      || (group_size == 0) || (generator_count > group_size))
+    {
+      return GrpErr_CheckpointMismatch;
+    }
+
+  // The rest of the file must hold exactly the values, checked before a
+  // damaged size is trusted with an allocation
+  std::streamoff header_end = in.tellg();
+
+  in.seekg(0, std::ios::end);
+  if (static_cast<uint64_t>(in.tellg() - header_end)
+      != (static_cast<uint64_t>(generator_count) + group_size) * order)
+    {
+      return GrpErr_CheckpointMismatch;
+    }
+  in.seekg(header_end);
+
+  std::vector<GroupElement> group_generators(generator_count);
+  std::string value(order, '\0');
+  GrpErr_t rVal = GrpErr_OK;
+
+  for (uint32_t idx = 0; idx < generator_count; idx++)
+    {
+      in.read(&value[0], order);
+      if (!in)
+        {
+          return GrpErr_FileAccess;
+        }
+      rVal = group_generators[idx].try_set_element(value);
+      if (rVal != GrpErr_OK)
+        {
+          return rVal;
+        }
+    }
+
+  std::string values(static_cast<size_t>(group_size) * order, '\0');
+
+  in.read(&values[0], values.size());
+  if (!in)
+    {
+      return GrpErr_FileAccess;
+    }
+
+  G = std::make_shared<Group>();
+  rVal = G->set_packed_values(values.data(), group_size, order, group_generators);
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+  // A repeated value would leave a smaller set than was saved
+  if (G->size() != group_size)
+    {
+      G.reset();
+      return GrpErr_CheckpointMismatch;
+    }
+  return GrpErr_OK;
+}
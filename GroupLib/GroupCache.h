@@ -0,0 +1,117 @@
+/******************************************************************************/
+/*                                                                            */
+/*  GroupCache.h: Generated groups kept by a canonical key                    */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#ifndef GROUP_CACHE_H__
+#define GROUP_CACHE_H__
+
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+
+// Groups kept in memory by default
+const size_t default_cache_groups = 64;
+
+// The layout of a saved group, integers in host byte order:
+//   char     magic[8]                     "GRPCACH1"
+//   uint32_t key_length
+//   char     key[key_length]
+//   uint32_t order, size, generator_count
+//   char     generators[generator_count * order]
+//   char     values[size * order]         in index order
+extern const char group_cache_magic[8];
+
+// Generated groups kept by a canonical key, the least recently used
+// dropped first, and optionally saved to a directory so later processes
+// load them instead of generating them again.  A cached group is shared
+// with the cache and every caller asking for it, so it must not be
+// changed; copy it first.  Its index is built before it is shared, so
+// readers on several threads need no locking.
+class GroupCache
+{
+ public:
+  // directory, when not empty, must already exist
+  GroupCache(size_t capacity = default_cache_groups,
+             const std::string &directory = "");
+  ~GroupCache();
+
+  // GrpGen_Sn, GrpGen_An, GrpGen_Dn and GrpGen_Cn with the parameter
+  // their generate_* method takes
+  GrpErr_t generate(GrpGen_t type, uint32_t parameter,
+                    std::shared_ptr<Group> &G);
+  // The closure of the generators, one entry whatever their order or
+  // repeats
+  GrpErr_t generate(const std::vector<GroupElement> &group_generators,
+                    std::shared_ptr<Group> &G);
+
+  // The canonical keys, e.g. "Dn 12" and "5: 01243 12340"
+  static std::string key(GrpGen_t type, uint32_t parameter);
+  static std::string key(const std::vector<GroupElement> &group_generators);
+
+  // Empties the memory; saved groups are kept
+  void clear(void);
+  size_t size(void);
+
+  uint64_t get_hits(void);
+  uint64_t get_disk_hits(void);
+  uint64_t get_misses(void);
+
+ private:
+  typedef std::list<std::pair<std::string, std::shared_ptr<Group> > > EntryList;
+
+  // Memory then disk
+  bool find(const std::string &group_key, std::shared_ptr<Group> &G);
+  // Keeps the first group stored under a key if two threads made it
+  void insert(const std::string &group_key, std::shared_ptr<Group> &G);
+
+  std::string file_name(const std::string &group_key) const;
+  GrpErr_t save(const std::string &group_key, Group &G);
+  GrpErr_t load(const std::string &group_key, std::shared_ptr<Group> &G);
+
+  size_t capacity;
+  std::string directory;
+
+  // Most recently used first
+  EntryList entries;
+  std::unordered_map<std::string, EntryList::iterator> lookup;
+  std::mutex lock;
+
+  uint64_t hits;
+  uint64_t disk_hits;
+  uint64_t misses;
+};
+
+#endif // GROUP_CACHE_H__
@@ -32,12 +32,27 @@ GroupElement::operator =(const GroupElement& rhs)
 bool
 GroupElement::operator ==(const GroupElement& rhs) const
 {
-  if (rhs.get_order() != get_order())
+  bool equal;
+  GrpErr_t rVal = try_equals(rhs, equal);
+
+  if (rVal != GrpErr_OK)
     {
-      GroupError gp(GrpErr_IncompatibleGroupElement);
+      GroupError gp(rVal);
       throw gp;
     }
-  return (get_element() == rhs.get_element());
+  return equal;
+}
+
+GrpErr_t
+GroupElement::try_equals(const GroupElement& rhs, bool &equal) const noexcept
+{
+  equal = false;
+  if (rhs.get_order() != get_order())
+    {
+      return GrpErr_IncompatibleGroupElement;
+    }
+  equal = (value == rhs.value);
+  return GrpErr_OK;
 }
 
 bool
@@ -65,39 +80,35 @@ GroupElement::operator >(const GroupElement& rhs) const
 GroupElement
 GroupElement::operator *=(const GroupElement & rhs)
   {
-    if (!check_element(rhs))
+    GrpErr_t rVal = try_multiply(rhs);
+
+    if (rVal != GrpErr_OK)
       {
-        GroupError gp(GrpErr_IncompatibleGroupElement);
+        GroupError gp(rVal);
 
         throw gp;
       }
 
-    GroupElement new_element;
-
-    std::string rhs_element_value;
-    std::string our_element_value;
-    std::string new_element_value;
-
-    uint32_t order;
-
-    order = rhs.get_order();
-
-    rhs_element_value = rhs.get_element();
-    our_element_value = get_element();
-
-    new_element.set_order(order);
+    return *this;
 
-    for (uint32_t i = 0; i < order; i++)
-      {
-        new_element_value
-          += our_element_value[rhs_element_value[i] - '0'];
-      }
+  }
 
-    set_element(new_element_value);
+GrpErr_t
+GroupElement::try_multiply(const GroupElement &rhs) noexcept
+{
+  if (!check_element(rhs))
+    {
+      return GrpErr_IncompatibleGroupElement;
+    }
 
-    return *this;
+  std::string new_element_value;
 
-  }
+  // A product of permutations is one, so only the inverse is redone
+  multiply_element_values(value, rhs.value, new_element_value);
+  value.swap(new_element_value);
+  eveness = 0;
+  return create_inverse();
+}
 
 void
 GroupElement::set_order(uint32_t order)
@@ -119,29 +130,36 @@ GroupElement::set_order(uint32_t order)
 
 void
 GroupElement::set_element(const std::string  str_element_values)
+{
+  GrpErr_t element_err = try_set_element(str_element_values);
+
+  if (element_err != GrpErr_OK)
+    {
+      GroupError gp(element_err);
+      throw gp;
+    }
+}
+
+GrpErr_t
+GroupElement::try_set_element(const std::string &str_element_values) noexcept
 {
   uint32_t order = str_element_values.size();
   GrpErr_t element_err = GrpErr_OK;
 
   if (order > max_order)
     {
-        GroupError gp(GrpErr_ElementOverflow);
-      throw gp;
+      return GrpErr_ElementOverflow;
     }
 
   set_order(order);
 
-  if ((element_err = check_element_values(str_element_values)) == GrpErr_OK)
+  if ((element_err = check_element_values(str_element_values)) != GrpErr_OK)
     {
-      value = str_element_values;
-      inverse.clear();
-    }
-  else
-    {
-      GroupError gp(element_err);
-      throw gp;
+      return element_err;
     }
-  create_inverse();
+  value = str_element_values;
+  inverse.clear();
+  return create_inverse();
 }
 
 
@@ -163,6 +181,10 @@ GroupElement::check_element_values(const std::string & element_values)
 {
   uint32_t element_order = element_values.size();
 
+  if (element_order > max_order)
+    {
+      return GrpErr_ElementOverflow;
+    }
   group_order_map.reset();
   for (uint32_t idx = 0; idx < element_order; idx++)
     {
@@ -211,11 +233,28 @@ GroupElement::get_order(void) const
 std::string
 GroupElement::get_inverse(void)
 {
+  std::string inverse_value;
+  GrpErr_t rVal = try_get_inverse(inverse_value);
+
+  if (rVal != GrpErr_OK)
+    {
+      GroupError gp(rVal);
+      throw gp;
+    }
+  return inverse_value;
+}
+
+GrpErr_t
+GroupElement::try_get_inverse(std::string &inverse_value) noexcept
+{
+  GrpErr_t rVal = GrpErr_OK;
+
   if (inverse.empty())
     {
-      create_inverse();
+      rVal = create_inverse();
     }
-  return inverse;
+  inverse_value = inverse;
+  return rVal;
 }
 
 
@@ -238,16 +277,15 @@ GroupElement::create_identity(void)
   return identity;
 }
 
-void
-GroupElement::create_inverse(void)
+GrpErr_t
+GroupElement::create_inverse(void) noexcept
 {
   std::string inverse_generator;
   uint32_t element_order = get_order();
 
   if (element_order == 0)
     {
-      GroupError gp(GrpErr_UndefinedGroupOrder);
-      throw gp;
+      return GrpErr_UndefinedGroupOrder;
     }
 
   inverse_generator = value;
@@ -272,17 +310,162 @@ GroupElement::create_inverse(void)
             }
         }
     }
+  return GrpErr_OK;
 }
 
 bool
 GroupElement::is_odd(void) const
 {
-  if (eveness == -1)
+  bool odd;
+  GrpErr_t rVal = try_is_odd(odd);
+
+  if (rVal != GrpErr_OK)
     {
       GroupError error;
-      error.set_error_code(GrpErr_UninitializedElement);
+      error.set_error_code(rVal);
       throw(error);
       //create_inverse();
     }
-  return eveness % 2;
+  return odd;
+}
+
+GrpErr_t
+GroupElement::try_is_odd(bool &odd) const noexcept
+{
+  odd = false;
+  if (eveness == -1)
+    {
+      return GrpErr_UninitializedElement;
+    }
+  odd = eveness % 2;
+  return GrpErr_OK;
+}
+
+uint64_t
+GroupElement::get_rank(void) const
+{
+  return rank_element_value(value);
+}
+
+// Same composition as operator *= without the checks or the inverse:
+// product[i] = lhs[rhs[i]]
+void
+multiply_element_values(const std::string &lhs,
+                        const std::string &rhs,
+                        std::string &product)
+{
+  uint32_t order = rhs.size();
+
+  product.resize(order);
+  for (uint32_t i = 0; i < order; i++)
+    {
+      product[i] = lhs[rhs[i] - '0'];
+    }
+}
+
+void
+invert_element_value(const std::string &element_value,
+                     std::string &inverse)
+{
+  uint32_t order = element_value.size();
+
+  inverse.resize(order);
+  for (uint32_t i = 0; i < order; i++)
+    {
+      inverse[element_value[i] - '0'] = i + '0';
+    }
+}
+
+// The Lehmer code read as a factorial base number.  The identity has
+// rank 0 and the reversal has rank order! - 1.
+uint64_t
+rank_element_value(const std::string &element_value)
+{
+  return rank_element_value(element_value.data(), element_value.size());
+}
+
+uint64_t
+rank_element_value(const char *element_value, uint32_t order)
+{
+  uint32_t used = 0;
+  uint64_t rank = 0;
+
+  for (uint32_t i = 0; i < order; i++)
+    {
+      uint32_t digit = element_value[i] - '0';
+      uint32_t smaller_used = __builtin_popcount(used & ((1u << digit) - 1));
+
+      rank = rank * (order - i) + (digit - smaller_used);
+      used |= 1u << digit;
+    }
+  return rank;
+}
+
+// Inverse of rank_element_value: read the factorial base digits of the
+// rank and take the digit-th unused value at each position
+void
+unrank_element_value(uint32_t order, uint64_t rank,
+                     std::string &element_value)
+{
+  element_value.resize(order);
+  unrank_element_value(order, rank, &element_value[0]);
+}
+
+void
+unrank_element_value(uint32_t order, uint64_t rank, char *element_value)
+{
+  uint32_t digits[max_order];
+  uint32_t used = 0;
+
+  for (uint32_t i = order; i-- > 0; )
+    {
+      digits[i] = rank % (order - i);
+      rank /= (order - i);
+    }
+
+  for (uint32_t i = 0; i < order; i++)
+    {
+      uint32_t value = 0;
+      uint32_t skip = digits[i];
+
+      for (;; value++)
+        {
+          if (used & (1u << value))
+            {
+              continue;
+            }
+          if (skip == 0)
+            {
+              break;
+            }
+          skip--;
+        }
+      used |= 1u << value;
+      element_value[i] = value + '0';
+    }
+}
+
+// A permutation of n points with c cycles is a product of n - c
+// transpositions
+bool
+is_odd_element_value(const std::string &element_value)
+{
+  uint32_t order = element_value.size();
+  uint32_t visited = 0;
+  uint32_t cycles = 0;
+
+  for (uint32_t start = 0; start < order; start++)
+    {
+      if (visited & (1u << start))
+        {
+          continue;
+        }
+      cycles++;
+      for (uint32_t point = start; !(visited & (1u << point));
+           point = element_value[point] - '0')
+        {
+          visited |= 1u << point;
+        }
+    }
+  return (order - cycles) % 2;
 }
@@ -80,22 +80,50 @@ class GroupElement
   std::string get_inverse(void);
   bool is_odd(void) const;
 
+  // Lehmer rank amongst all permutations of the element's order
+  uint64_t get_rank(void) const;
+
   const std::string &get_error_msg(GrpErr_t error);
 
+  // The same operations reporting their errors instead of throwing, for
+  // inner loops and for code built without exceptions.  The throwing
+  // versions above are wrappers around these.  On an error the element
+  // is left as the throwing version leaves it.
+  GrpErr_t try_set_element(const std::string &element_str) noexcept;
+  GrpErr_t try_multiply(const GroupElement &rhs) noexcept;
+  GrpErr_t try_equals(const GroupElement &rhs, bool &equal) const noexcept;
+  GrpErr_t try_get_inverse(std::string &inverse_value) noexcept;
+  GrpErr_t try_is_odd(bool &odd) const noexcept;
+
  private:
   std::string value;
   std::string inverse;
 
-  void create_inverse(void);
+  GrpErr_t create_inverse(void) noexcept;
 
  private:
-  std::bitset<8> group_order_map;
+  std::bitset<max_order> group_order_map;
   int32_t eveness;
 };
 
 bool check_element_value(std::string element_value, uint32_t order);
 bool is_even(GroupElement &G);
 
+// Unchecked operations on raw element values for the inner loops of the
+// group algorithms.  The values must already be valid and of equal order.
+void multiply_element_values(const std::string &lhs,
+                             const std::string &rhs,
+                             std::string &product);
+void invert_element_value(const std::string &element_value,
+                          std::string &inverse);
+uint64_t rank_element_value(const std::string &element_value);
+uint64_t rank_element_value(const char *element_value, uint32_t order);
+void unrank_element_value(uint32_t order, uint64_t rank,
+                          std::string &element_value);
+// element_value has room for order characters
+void unrank_element_value(uint32_t order, uint64_t rank, char *element_value);
+bool is_odd_element_value(const std::string &element_value);
+
 inline GroupElement
 operator *(GroupElement lhs, const GroupElement& rhs)
 {
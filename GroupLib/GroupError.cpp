@@ -46,12 +46,15 @@ const std::string group_element_error_code[] =
     "GrpErr_BadRotationDirection",     // == 13
     "GrpErr_UnimplimentedFunction",    // == 14
     "GrpErr_UninitializedElement",     // == 15
-    "GrpErr_UnknownError"              // == 16
+    "GrpErr_NotNormalSubgroup",        // == 16
+    "GrpErr_FileAccess",               // == 17
+    "GrpErr_CheckpointMismatch",       // == 18
+    "GrpErr_ParseError",               // == 19
+    "GrpErr_NotTransitive",            // == 20
+    "GrpErr_VisitStopped",             // == 21
+    "GrpErr_UnknownError"              // == 22
   };
 
-// TODO: Need to consider if this is needed
-const uint32_t max_order = 8;
-
 GroupError::GroupError(GrpErr_t error)
 {
   set_error_code(error);
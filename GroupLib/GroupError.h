@@ -27,6 +27,8 @@
 #ifndef GROUP_ERROR_H__
 #define  GROUP_ERROR_H__
 
+#include <stdint.h>
+
 #include <string>
 
 
@@ -48,11 +50,18 @@ typedef enum
     GrpErr_BadRotationDirection     = 13,
     GrpErr_UnimplimentedFunction    = 14,
     GrpErr_UninitializedElement     = 14,
-    GrpErr_MaxError                 = 16,
+    GrpErr_NotNormalSubgroup        = 16,  // A quotient by a subgroup that is not normal
+    GrpErr_FileAccess               = 17,  // A file could not be read or written
+    GrpErr_CheckpointMismatch       = 18,  // A checkpoint from a different computation
+    GrpErr_ParseError               = 19,  // Text that is not an element
+    GrpErr_NotTransitive            = 20,  // Blocks asked of an intransitive group
+    GrpErr_VisitStopped             = 21,  // A visitor ended a walk before its end
+    GrpErr_MaxError                 = 22,
     GrpErr_UnknownError             =  GrpErr_MaxError
   } GrpErr_t;
 
-extern const uint32_t max_order;
+// Largest element order; the element values are characters from '0'
+const uint32_t max_order = 16;
 
 class GroupError
 {
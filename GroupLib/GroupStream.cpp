@@ -0,0 +1,230 @@
+/******************************************************************************/
+/*                                                                            */
+/*  GroupStream.cpp: Visiting generated group elements without storing them   */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+#include <stdint.h>
+
+#include <algorithm>   // std::reverse
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "GroupStream.h"
+
+static std::string
+identity_value(uint32_t order)
+{
+  std::string value;
+
+  for (uint32_t i = 0; i < order; i++)
+    {
+      value += i + '0';
+    }
+  return value;
+}
+
+static GrpErr_t
+check_stream_order(uint32_t order)
+{
+  if (order == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  if (order > max_order)
+    {
+      return GrpErr_ElementOverflow;
+    }
+  return GrpErr_OK;
+}
+
+// The swap is one transposition and reversing a suffix of length m is
+// m/2 more
+bool
+next_element_value(std::string &value, bool &odd)
+{
+  int32_t order = value.size();
+  int32_t i = order - 2;
+
+  while (i >= 0 && value[i] >= value[i + 1])
+    {
+      i--;
+    }
+  if (i < 0)
+    {
+      return false;
+    }
+
+  int32_t j = order - 1;
+
+  while (value[j] <= value[i])
+    {
+      j--;
+    }
+  std::swap(value[i], value[j]);
+  std::reverse(value.begin() + i + 1, value.end());
+
+  odd ^= (1 + (order - 1 - i) / 2) & 1;
+  return true;
+}
+
+GrpErr_t
+for_each_Sn(uint32_t order, GrpVisitor_t visit)
+{
+  GrpErr_t rVal = check_stream_order(order);
+
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+
+  std::string value = identity_value(order);
+  bool odd = false;
+
+  do
+    {
+      if (!visit(value))
+        {
+          break;
+        }
+    } while (next_element_value(value, odd));
+
+  return rVal;
+}
+
+GrpErr_t
+for_each_An(uint32_t order, GrpVisitor_t visit)
+{
+  GrpErr_t rVal = check_stream_order(order);
+
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+
+  std::string value = identity_value(order);
+  bool odd = false;
+
+  do
+    {
+      if (!odd && !visit(value))
+        {
+          break;
+        }
+    } while (next_element_value(value, odd));
+
+  return rVal;
+}
+
+GrpErr_t
+for_each_Cn(uint32_t vertices, GrpVisitor_t visit)
+{
+  GrpErr_t rVal = check_stream_order(vertices);
+
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+
+  std::string value = identity_value(vertices);
+
+  for (uint32_t step = 0; step < vertices; step++)
+    {
+      // Rotation by step, as generate_Cn's left rotation of the values
+      for (uint32_t i = 0; i < vertices; i++)
+        {
+          value[i] = (i + step) % vertices + '0';
+        }
+      if (!visit(value))
+        {
+          break;
+        }
+    }
+  return rVal;
+}
+
+GrpErr_t
+for_each_Dn(uint32_t vertices, GrpVisitor_t visit)
+{
+  GrpErr_t rVal = check_stream_order(vertices);
+
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+
+  std::string value = identity_value(vertices);
+
+  for (uint32_t step = 0; step < vertices; step++)
+    {
+      for (uint32_t i = 0; i < vertices; i++)
+        {
+          value[i] = (i + step) % vertices + '0';
+        }
+      if (!visit(value))
+        {
+          return rVal;
+        }
+    }
+
+  // The reflections i -> step - i, through a vertex or an edge midpoint
+  for (uint32_t step = 0; vertices > 2 && step < vertices; step++)
+    {
+      for (uint32_t i = 0; i < vertices; i++)
+        {
+          value[i] = (step + vertices - i) % vertices + '0';
+        }
+      if (!visit(value))
+        {
+          break;
+        }
+    }
+  return rVal;
+}
+
+GrpErr_t
+for_each_cyclic(const GroupElement &e, GrpVisitor_t visit)
+{
+  GrpErr_t rVal = check_stream_order(e.get_order());
+
+  if (rVal != GrpErr_OK)
+    {
+      return rVal;
+    }
+
+  std::string generator = e.get_element();
+  std::string identity = identity_value(generator.size());
+  std::string value = identity;
+  std::string product;
+
+  do
+    {
+      if (!visit(value))
+        {
+          break;
+        }
+      multiply_element_values(value, generator, product);
+      value.swap(product);
+    } while (value != identity);
+
+  return rVal;
+}
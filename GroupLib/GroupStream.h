@@ -0,0 +1,63 @@
+/******************************************************************************/
+/*                                                                            */
+/*  GroupStream.h Definitions for visiting group elements one at a time       */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef GROUP_STREAM_H__
+#define GROUP_STREAM_H__
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+
+// Streaming counterparts of the Group generate_* methods.  Each element
+// value is passed to the visitor as it is produced and nothing is kept,
+// so the working set is a few copies of one element value.  The visitor
+// returns false to stop early.  The value is only valid during the call.
+typedef std::function<bool(const std::string &element_value)> GrpVisitor_t;
+
+// Sn in lexicographic order, the same order as the Group element indices
+GrpErr_t for_each_Sn(uint32_t order, GrpVisitor_t visit);
+
+// The even permutations of Sn in lexicographic order
+GrpErr_t for_each_An(uint32_t order, GrpVisitor_t visit);
+
+// Rotations then reflections of a polygon with the given vertices
+GrpErr_t for_each_Dn(uint32_t vertices, GrpVisitor_t visit);
+
+// Rotations of a polygon with the given vertices
+GrpErr_t for_each_Cn(uint32_t vertices, GrpVisitor_t visit);
+
+// The cyclic group generated by e, starting with the identity
+GrpErr_t for_each_cyclic(const GroupElement &e, GrpVisitor_t visit);
+
+// Steps value to the next permutation in lexicographic order, returning
+// false after the last.  odd tracks the parity across the step.
+bool next_element_value(std::string &value, bool &odd);
+
+#endif // GROUP_STREAM_H__
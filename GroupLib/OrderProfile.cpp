@@ -0,0 +1,280 @@
+/******************************************************************************/
+/*                                                                            */
+/*  OrderProfile.cpp: Parallel element order and cyclic subgroup counts       */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+#include "OrderProfile.h"
+
+// Elements handed to a worker at a time
+const uint32_t profile_block = 4096;
+
+static uint32_t
+gcd(uint32_t a, uint32_t b)
+{
+  while (b != 0)
+    {
+      uint32_t t = a % b;
+      a = b;
+      b = t;
+    }
+  return a;
+}
+
+uint32_t
+element_value_order(const char *element_value, uint32_t order)
+{
+  uint32_t visited = 0;
+  uint32_t lcm = 1;
+
+  for (uint32_t start = 0; start < order; start++)
+    {
+      if (visited & (1u << start))
+        {
+          continue;
+        }
+
+      uint32_t length = 0;
+      uint32_t point = start;
+
+      do
+        {
+          visited |= 1u << point;
+          point = element_value[point] - '0';
+          length++;
+        } while (point != start);
+
+      lcm = lcm / gcd(lcm, length) * length;
+    }
+  return lcm;
+}
+
+// Is g the lexicographically smallest generator of <g>?  The generators
+// are the powers g^j with j coprime to the order, and element indices
+// follow the lexicographic order of the values.
+static bool
+is_minimal_generator(const char *g, uint32_t order, uint32_t element_order)
+{
+  char power[max_order];
+  char cycle[max_order];
+  uint32_t cycle_start[max_order];
+  uint32_t cycle_length[max_order];
+  uint32_t position[max_order];
+  uint32_t visited = 0;
+  uint32_t cycle_points = 0;
+
+  // Lay the cycles out one after another so g^j is a rotation of each
+  for (uint32_t start = 0; start < order; start++)
+    {
+      if (visited & (1u << start))
+        {
+          continue;
+        }
+
+      uint32_t first = cycle_points;
+      uint32_t point = start;
+
+      do
+        {
+          visited |= 1u << point;
+          cycle[cycle_points] = point;
+          position[point] = cycle_points;
+          cycle_points++;
+          point = g[point] - '0';
+        } while (point != start);
+
+      for (uint32_t idx = first; idx < cycle_points; idx++)
+        {
+          cycle_start[idx] = first;
+          cycle_length[idx] = cycle_points - first;
+        }
+    }
+
+  for (uint32_t j = 2; j < element_order; j++)
+    {
+      if (gcd(j, element_order) != 1)
+        {
+          continue;
+        }
+      for (uint32_t point = 0; point < order; point++)
+        {
+          uint32_t p = position[point];
+          uint32_t offset = (p - cycle_start[p] + j) % cycle_length[p];
+
+          power[point] = cycle[cycle_start[p] + offset] + '0';
+        }
+      if (memcmp(power, g, order) < 0)
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+typedef struct
+{
+  const char *values;
+  uint32_t order;
+  uint32_t group_size;
+  std::atomic<uint32_t> *next_block;
+
+  std::vector<uint64_t> orders;
+  std::vector<uint64_t> cyclic;
+  std::vector<uint32_t> subgroups;
+} ProfileWorker;
+
+// Takes blocks of elements until none are left
+static void
+profile_worker(ProfileWorker *work)
+{
+  uint32_t block;
+
+  while ((block = work->next_block->fetch_add(profile_block)) < work->group_size)
+    {
+      uint32_t end = std::min(work->group_size, block + profile_block);
+
+      for (uint32_t idx = block; idx < end; idx++)
+        {
+          const char *g = work->values + static_cast<size_t>(idx) * work->order;
+          uint32_t element_order = element_value_order(g, work->order);
+
+          if (element_order >= work->orders.size())
+            {
+              work->orders.resize(element_order + 1, 0);
+              work->cyclic.resize(element_order + 1, 0);
+            }
+          work->orders[element_order]++;
+          if (is_minimal_generator(g, work->order, element_order))
+            {
+              work->cyclic[element_order]++;
+              work->subgroups.push_back(idx);
+            }
+        }
+    }
+}
+
+OrderProfile::OrderProfile()
+{
+}
+
+OrderProfile::~OrderProfile()
+{
+}
+
+void
+OrderProfile::clear(void)
+{
+  order_histogram.clear();
+  cyclic_histogram.clear();
+  cyclic_subgroups.clear();
+}
+
+GrpErr_t
+OrderProfile::generate(Group &G, uint32_t threads)
+{
+  clear();
+
+  uint32_t group_size = G.size();
+  uint32_t order = G.get_element_order();
+  const char *values = G.get_packed_values();
+
+  if (group_size == 0)
+    {
+      return GrpErr_ElementValueNull;
+    }
+  if (threads == 0)
+    {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+  // Per worker counts indexed by element order, merged at the end
+  std::vector<ProfileWorker> work(threads);
+  std::atomic<uint32_t> next_block(0);
+  std::vector<std::thread> workers;
+
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      work[t].values = values;
+      work[t].order = order;
+      work[t].group_size = group_size;
+      work[t].next_block = &next_block;
+      workers.push_back(std::thread(profile_worker, &work[t]));
+    }
+
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      workers[t].join();
+    }
+
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      for (uint32_t k = 0; k < work[t].orders.size(); k++)
+        {
+          if (work[t].orders[k] != 0)
+            {
+              order_histogram[k] += work[t].orders[k];
+              cyclic_histogram[k] += work[t].cyclic[k];
+            }
+        }
+      cyclic_subgroups.insert(cyclic_subgroups.end(),
+                              work[t].subgroups.begin(),
+                              work[t].subgroups.end());
+    }
+  std::sort(cyclic_subgroups.begin(), cyclic_subgroups.end());
+
+  return GrpErr_OK;
+}
+
+const std::map<uint32_t, uint64_t> &
+OrderProfile::get_order_histogram(void) const
+{
+  return order_histogram;
+}
+
+const std::vector<uint32_t> &
+OrderProfile::get_cyclic_subgroups(void) const
+{
+  return cyclic_subgroups;
+}
+
+uint64_t
+OrderProfile::count_cyclic_subgroups(uint32_t order) const
+{
+  std::map<uint32_t, uint64_t>::const_iterator found;
+
+  found = cyclic_histogram.find(order);
+  if (found == cyclic_histogram.end())
+    {
+      return 0;
+    }
+  return found->second;
+}
@@ -0,0 +1,81 @@
+/******************************************************************************/
+/*                                                                            */
+/*  OrderProfile.h Definitions for element order and cyclic subgroup counts  */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef ORDER_PROFILE_H__
+#define ORDER_PROFILE_H__
+
+#include <stdint.h>
+
+#include <map>
+#include <vector>
+
+#include "GroupError.h"
+#include "Group.h"
+
+// How many elements of each order a group has and which cyclic
+// subgroups it contains.  The elements are split over worker threads,
+// each keeping its own counts until the final merge.
+class OrderProfile
+{
+ public:
+  OrderProfile();
+  ~OrderProfile();
+
+  friend std::ostream &operator <<(std::ostream &output, OrderProfile &P)
+  {
+    std::map<uint32_t, uint64_t>::iterator itr;
+
+    for (itr = P.order_histogram.begin(); itr != P.order_histogram.end(); ++itr)
+      {
+        output << "order " << itr->first << ": " << itr->second
+               << " elements, " << P.count_cyclic_subgroups(itr->first)
+               << " cyclic subgroups\n";
+      }
+    return output;
+  }
+
+  // threads == 0 uses one worker per hardware thread
+  GrpErr_t generate(Group &G, uint32_t threads = 0);
+  void clear(void);
+
+  // element order -> number of elements of that order
+  const std::map<uint32_t, uint64_t> &get_order_histogram(void) const;
+
+  // Each cyclic subgroup once, as the element index of its smallest
+  // generator, in ascending order
+  const std::vector<uint32_t> &get_cyclic_subgroups(void) const;
+  uint64_t count_cyclic_subgroups(uint32_t order) const;
+
+ private:
+  std::map<uint32_t, uint64_t> order_histogram;
+  std::map<uint32_t, uint64_t> cyclic_histogram;
+  std::vector<uint32_t> cyclic_subgroups;
+};
+
+// Order of the permutation, the lcm of its cycle lengths
+uint32_t element_value_order(const char *element_value, uint32_t order);
+
+#endif // ORDER_PROFILE_H__
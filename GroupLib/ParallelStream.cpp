@@ -0,0 +1,242 @@
+/******************************************************************************/
+/*                                                                            */
+/*  ParallelStream.cpp: Work stealing enumeration of Sn by rank ranges        */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "GroupStream.h"
+#include "ParallelStream.h"
+
+// Tasks queued per worker, enough that stealing can even out the load
+const uint64_t tasks_per_worker = 64;
+// Smallest task, so short ranges are not cut into single elements
+const uint64_t min_task_size = 1024;
+
+typedef struct
+{
+  uint64_t first_rank;
+  uint64_t last_rank;
+} RankTask;
+
+typedef struct
+{
+  std::mutex lock;
+  std::deque<RankTask> tasks;
+} TaskQueue;
+
+typedef struct
+{
+  uint32_t order;
+  uint32_t worker;
+  std::vector<TaskQueue> *queues;
+  std::atomic<bool> *stop;
+  ParallelVisitor *visitor;
+} WorkerContext;
+
+uint64_t
+permutation_count(uint32_t order)
+{
+  uint64_t count = 1;
+
+  for (uint32_t i = 2; i <= order; i++)
+    {
+      if (count > UINT64_MAX / i)
+        {
+          return 0;
+        }
+      count *= i;
+    }
+  return count;
+}
+
+// The owner takes from the back of its own queue, thieves from the front
+static bool
+take_task(WorkerContext *context, RankTask &task)
+{
+  std::vector<TaskQueue> &queues = *context->queues;
+  uint32_t workers = queues.size();
+
+  {
+    std::lock_guard<std::mutex> guard(queues[context->worker].lock);
+
+    if (!queues[context->worker].tasks.empty())
+      {
+        task = queues[context->worker].tasks.back();
+        queues[context->worker].tasks.pop_back();
+        return true;
+      }
+  }
+
+  for (uint32_t offset = 1; offset < workers; offset++)
+    {
+      TaskQueue &victim = queues[(context->worker + offset) % workers];
+      std::lock_guard<std::mutex> guard(victim.lock);
+
+      if (!victim.tasks.empty())
+        {
+          task = victim.tasks.front();
+          victim.tasks.pop_front();
+          return true;
+        }
+    }
+  // No tasks are created once the workers start, so empty queues stay
+  // empty
+  return false;
+}
+
+static void
+rank_worker(WorkerContext *context)
+{
+  RankTask task;
+  std::string value;
+
+  while (!context->stop->load(std::memory_order_relaxed)
+         && take_task(context, task))
+    {
+      unrank_element_value(context->order, task.first_rank, value);
+
+      bool odd = is_odd_element_value(value);
+
+      for (uint64_t rank = task.first_rank; rank < task.last_rank; rank++)
+        {
+          if (!context->visitor->visit(value, rank, odd))
+            {
+              context->stop->store(true);
+              return;
+            }
+          if (context->stop->load(std::memory_order_relaxed))
+            {
+              return;
+            }
+          next_element_value(value, odd);
+        }
+    }
+}
+
+GrpErr_t
+parallel_for_each_rank(uint32_t order,
+                       uint64_t first_rank, uint64_t last_rank,
+                       ParallelVisitor &visitor,
+                       uint32_t threads)
+{
+  uint64_t permutations = permutation_count(order);
+
+  if (order == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  if (order > max_order || permutations == 0)
+    {
+      return GrpErr_ElementOverflow;
+    }
+  if (first_rank > last_rank || last_rank > permutations)
+    {
+      return GrpErr_IndexOutOfBounds;
+    }
+  if (threads == 0)
+    {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+  // Consecutive tasks go to the same worker so each mostly walks one
+  // contiguous stretch of ranks
+  uint64_t span = last_rank - first_rank;
+  uint64_t task_size = std::max(min_task_size,
+                                span / (threads * tasks_per_worker) + 1);
+  uint64_t task_count = (span + task_size - 1) / task_size;
+  uint64_t tasks_each = (task_count + threads - 1) / threads;
+  std::vector<TaskQueue> queues(threads);
+
+  for (uint64_t idx = 0; idx < task_count; idx++)
+    {
+      RankTask task;
+
+      task.first_rank = first_rank + idx * task_size;
+      task.last_rank = std::min(last_rank, task.first_rank + task_size);
+      queues[idx / tasks_each].tasks.push_front(task);
+    }
+
+  std::atomic<bool> stop(false);
+  std::vector<ParallelVisitor *> clones(threads);
+  std::vector<WorkerContext> contexts(threads);
+  std::vector<std::thread> workers;
+
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      clones[t] = visitor.clone();
+      contexts[t].order = order;
+      contexts[t].worker = t;
+      contexts[t].queues = &queues;
+      contexts[t].stop = &stop;
+      contexts[t].visitor = clones[t];
+      workers.push_back(std::thread(rank_worker, &contexts[t]));
+    }
+
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      workers[t].join();
+    }
+
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      visitor.merge(*clones[t]);
+      delete clones[t];
+    }
+  return stop.load() ? GrpErr_VisitStopped : GrpErr_OK;
+}
+
+GrpErr_t
+shard_rank_range(uint64_t total, uint32_t shard, uint32_t shards,
+                 uint64_t &first_rank, uint64_t &last_rank)
+{
+  if (shards == 0 || shard >= shards)
+    {
+      return GrpErr_IndexOutOfBounds;
+    }
+
+  uint64_t size = total / shards;
+  uint64_t extra = total % shards;
+
+  // The first extra shards take one more rank each
+  first_rank = shard * size + std::min<uint64_t>(shard, extra);
+  last_rank = first_rank + size + (shard < extra ? 1 : 0);
+  return GrpErr_OK;
+}
+
+GrpErr_t
+parallel_for_each_Sn(uint32_t order, ParallelVisitor &visitor,
+                     uint32_t threads)
+{
+  return parallel_for_each_rank(order, 0, permutation_count(order),
+                                visitor, threads);
+}
@@ -0,0 +1,79 @@
+/******************************************************************************/
+/*                                                                            */
+/*  ParallelStream.h Definitions for visiting Sn on several threads          */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef PARALLEL_STREAM_H__
+#define PARALLEL_STREAM_H__
+
+#include <stdint.h>
+
+#include <string>
+
+#include "GroupError.h"
+
+// State carried by one worker thread.  Each worker gets its own clone of
+// the visitor passed in, and after the workers finish every clone is
+// merged back into it.
+class ParallelVisitor
+{
+ public:
+  virtual ~ParallelVisitor() {};
+
+  // A fresh visitor with empty state for a worker
+  virtual ParallelVisitor *clone(void) const = 0;
+
+  // Called for each element with its Lehmer rank and parity.  Returning
+  // false stops every worker.
+  virtual bool visit(const std::string &element_value,
+                     uint64_t rank, bool odd) = 0;
+
+  // Fold the state of a finished worker into this visitor
+  virtual void merge(ParallelVisitor &worker) = 0;
+};
+
+// Sn split into rank ranges that are spread over the workers' task
+// queues.  A worker that empties its own queue steals from the others.
+// threads == 0 uses one worker per hardware thread.  When a visitor stops
+// the walk the clones are still merged, and GrpErr_VisitStopped is
+// returned, as only part of the range was visited.
+GrpErr_t parallel_for_each_Sn(uint32_t order, ParallelVisitor &visitor,
+                              uint32_t threads = 0);
+
+// The elements of Sn with first_rank <= rank < last_rank
+GrpErr_t parallel_for_each_rank(uint32_t order,
+                                uint64_t first_rank, uint64_t last_rank,
+                                ParallelVisitor &visitor,
+                                uint32_t threads = 0);
+
+// order!, 0 when it does not fit
+uint64_t permutation_count(uint32_t order);
+
+// Ranks [first_rank, last_rank) of shard k of N over total elements.
+// The shards are contiguous, cover every rank once and differ in size by
+// at most one, so separate processes agree on them without talking.
+GrpErr_t shard_rank_range(uint64_t total, uint32_t shard, uint32_t shards,
+                          uint64_t &first_rank, uint64_t &last_rank);
+
+#endif // PARALLEL_STREAM_H__
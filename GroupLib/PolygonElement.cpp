@@ -0,0 +1,174 @@
+/******************************************************************************/
+/*                                                                            */
+/*  PolygonElement.cpp: Closed form rotations and reflections                 */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <stdint.h>
+
+#include <string>
+
+#include "PolygonElement.h"
+
+static uint32_t
+gcd(uint32_t a, uint32_t b)
+{
+  while (b != 0)
+    {
+      uint32_t t = a % b;
+
+      a = b;
+      b = t;
+    }
+  return a;
+}
+
+static void
+check_polygon(uint32_t vertices)
+{
+  if (vertices == 0)
+    {
+      GroupError e(GrpErr_UndefinedGroupOrder);
+      throw e;
+    }
+}
+
+// The value of i -> step + i, or step - i for a flip, with the vertices
+// numbered the way direction asks
+static GrpErr_t
+polygon_value(uint32_t vertices, uint32_t step, bool flip,
+              GrpElDirection_t direction, GroupElement &element)
+{
+  if (vertices > max_order)
+    {
+      return GrpErr_ElementOverflow;
+    }
+  if (direction != GrpElDirection_left && direction != GrpElDirection_right)
+    {
+      return GrpErr_BadRotationDirection;
+    }
+
+  // Numbering the other way round turns i -> s + i into i -> -s + i
+  if (direction == GrpElDirection_right && step != 0)
+    {
+      step = vertices - step;
+    }
+
+  std::string value(vertices, '0');
+
+  for (uint32_t i = 0; i < vertices; i++)
+    {
+      uint32_t image = flip ? (step + vertices - i) % vertices
+                            : (step + i) % vertices;
+
+      value[i] = image + '0';
+    }
+  element.set_order(vertices);
+  element.set_element(value);
+  return GrpErr_OK;
+}
+
+RotationElement::RotationElement()
+{
+  vertices = 1;
+  step = 0;
+}
+
+RotationElement::RotationElement(uint32_t vertices, uint32_t step)
+{
+  check_polygon(vertices);
+  this->vertices = vertices;
+  this->step = step % vertices;
+}
+
+RotationElement::~RotationElement()
+{
+}
+
+uint32_t
+RotationElement::order(void) const
+{
+  return vertices / gcd(vertices, step);
+}
+
+GrpErr_t
+RotationElement::to_element(GroupElement &element,
+                            GrpElDirection_t direction) const
+{
+  return polygon_value(vertices, step, false, direction, element);
+}
+
+void
+RotationElement::check_vertices(uint32_t other) const
+{
+  if (other != vertices)
+    {
+      GroupError e(GrpErr_IncompatibleGroupElement);
+      throw e;
+    }
+}
+
+DihedralElement::DihedralElement()
+{
+  vertices = 1;
+  step = 0;
+  flip = false;
+}
+
+DihedralElement::DihedralElement(uint32_t vertices, uint32_t step, bool flip)
+{
+  check_polygon(vertices);
+  this->vertices = vertices;
+  this->step = step % vertices;
+  // With one or two vertices -i is i, so a flip is the rotation by step
+  this->flip = flip && (vertices > 2);
+}
+
+DihedralElement::~DihedralElement()
+{
+}
+
+uint32_t
+DihedralElement::order(void) const
+{
+  if (flip)
+    {
+      return 2;
+    }
+  return vertices / gcd(vertices, step);
+}
+
+GrpErr_t
+DihedralElement::to_element(GroupElement &element,
+                            GrpElDirection_t direction) const
+{
+  return polygon_value(vertices, step, flip, direction, element);
+}
+
+void
+DihedralElement::check_vertices(uint32_t other) const
+{
+  if (other != vertices)
+    {
+      GroupError e(GrpErr_IncompatibleGroupElement);
+      throw e;
+    }
+}
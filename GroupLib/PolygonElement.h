@@ -0,0 +1,151 @@
+/******************************************************************************/
+/*                                                                            */
+/*  PolygonElement.h Closed form elements of the Cn and Dn polygon groups     */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef POLYGON_ELEMENT_H__
+#define POLYGON_ELEMENT_H__
+
+#include <stdint.h>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+
+// The symmetries of a polygon as numbers rather than permutations.  The
+// vertex i goes to step + i, or to step - i when the element is a flip,
+// so products, inverses and orders take constant time whatever the
+// number of vertices.  The permutation form is only built on request and
+// only exists for vertices up to max_order.
+//
+// With GrpElDirection_left the vertices are read as generate_Cn and
+// for_each_Dn number them, the value "1230" being the rotation by one.
+// GrpElDirection_right reads them the other way round the polygon.
+
+// An element of Cn: rotation by step
+class RotationElement
+{
+ public:
+  RotationElement();
+  RotationElement(uint32_t vertices, uint32_t step);
+  ~RotationElement();
+
+  uint32_t get_vertices(void) const { return vertices; }
+  uint32_t get_step(void) const { return step; }
+
+  RotationElement operator *(const RotationElement &rhs) const
+  {
+    check_vertices(rhs.vertices);
+    return RotationElement(vertices, add_steps(step, rhs.step));
+  }
+
+  RotationElement inverse(void) const
+  {
+    return RotationElement(vertices, step == 0 ? 0 : vertices - step);
+  }
+
+  bool operator ==(const RotationElement &rhs) const
+  {
+    return vertices == rhs.vertices && step == rhs.step;
+  }
+  bool operator !=(const RotationElement &rhs) const
+  {
+    return !(*this == rhs);
+  }
+
+  uint32_t order(void) const;
+
+  GrpErr_t to_element(GroupElement &element,
+                      GrpElDirection_t direction = GrpElDirection_left) const;
+
+ private:
+  void check_vertices(uint32_t other) const;
+  uint32_t add_steps(uint32_t a, uint32_t b) const
+  {
+    return (a >= vertices - b) ? a - (vertices - b) : a + b;
+  }
+
+  uint32_t vertices;
+  uint32_t step;
+};
+
+// An element of Dn: rotation by step, or the flip i -> step - i.  With
+// two vertices or fewer the flips are rotations and are kept as such, so
+// equal permutations compare equal.
+class DihedralElement
+{
+ public:
+  DihedralElement();
+  DihedralElement(uint32_t vertices, uint32_t step, bool flip);
+  ~DihedralElement();
+
+  uint32_t get_vertices(void) const { return vertices; }
+  uint32_t get_step(void) const { return step; }
+  bool is_flip(void) const { return flip; }
+
+  // i -> a.step +/- (b.step +/- i)
+  DihedralElement operator *(const DihedralElement &rhs) const
+  {
+    check_vertices(rhs.vertices);
+
+    uint32_t rhs_step = (flip && rhs.step != 0) ? vertices - rhs.step
+                                                : rhs.step;
+    uint32_t sum = (step >= vertices - rhs_step) ? step - (vertices - rhs_step)
+                                                 : step + rhs_step;
+
+    return DihedralElement(vertices, sum, flip != rhs.flip);
+  }
+
+  // Flips are their own inverses
+  DihedralElement inverse(void) const
+  {
+    if (flip || step == 0)
+      {
+        return *this;
+      }
+    return DihedralElement(vertices, vertices - step, false);
+  }
+
+  bool operator ==(const DihedralElement &rhs) const
+  {
+    return vertices == rhs.vertices && step == rhs.step && flip == rhs.flip;
+  }
+  bool operator !=(const DihedralElement &rhs) const
+  {
+    return !(*this == rhs);
+  }
+
+  uint32_t order(void) const;
+
+  GrpErr_t to_element(GroupElement &element,
+                      GrpElDirection_t direction = GrpElDirection_left) const;
+
+ private:
+  void check_vertices(uint32_t other) const;
+
+  uint32_t vertices;
+  uint32_t step;
+  bool flip;
+};
+
+#endif // POLYGON_ELEMENT_H__
@@ -0,0 +1,166 @@
+/******************************************************************************/
+/*                                                                            */
+/*  QuotientGroup.cpp: Factor groups built from a group and normal subgroup   */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+#include <stdint.h>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+#include "QuotientGroup.h"
+
+QuotientGroup::QuotientGroup()
+{
+}
+
+QuotientGroup::~QuotientGroup()
+{
+}
+
+void
+QuotientGroup::clear(void)
+{
+  projection.clear();
+  representatives.clear();
+  table.clear();
+  inverses.clear();
+}
+
+GrpErr_t
+QuotientGroup::generate(Group &G, Group &N)
+{
+  GrpErr_t rVal = GrpErr_OK;
+  std::vector<uint32_t> transversal;
+
+  clear();
+
+  if (!G.is_normal(N))
+    {
+      return GrpErr_NotNormalSubgroup;
+    }
+  if ((rVal = G.left_cosets(N, projection, transversal)) != GrpErr_OK)
+    {
+      projection.clear();
+      return rVal;
+    }
+
+  uint32_t cosets = transversal.size();
+
+  representatives.resize(cosets);
+  for (uint32_t idx = 0; idx < cosets; idx++)
+    {
+      G.get_element(transversal[idx], representatives[idx]);
+    }
+
+  // Since N is normal (aN)(bN) = abN, so one parent table lookup per
+  // pair of representatives fills the table
+  table.assign(cosets * cosets, 0);
+  inverses.assign(cosets, 0);
+  for (uint32_t a = 0; a < cosets; a++)
+    {
+      for (uint32_t b = 0; b < cosets; b++)
+        {
+          uint32_t product_index;
+
+          if (!G.multiply_indices(transversal[a], transversal[b], product_index))
+            {
+              clear();
+              return GrpErr_MissingElement;
+            }
+
+          uint32_t product = projection[product_index];
+
+          table[a * cosets + b] = product;
+          if (product == 0)
+            {
+              inverses[a] = b;
+            }
+        }
+    }
+  return rVal;
+}
+
+uint32_t
+QuotientGroup::size(void) const
+{
+  return representatives.size();
+}
+
+bool
+QuotientGroup::get_representative(uint32_t coset, GroupElement &e) const
+{
+  if (coset >= representatives.size())
+    {
+      return false;
+    }
+  e = representatives[coset];
+  return true;
+}
+
+uint32_t
+QuotientGroup::project(uint32_t element_index) const
+{
+  if (element_index >= projection.size())
+    {
+      GroupError e(GrpErr_IndexOutOfBounds);
+      throw e;
+    }
+  return projection[element_index];
+}
+
+const std::vector<uint32_t> &
+QuotientGroup::get_projection(void) const
+{
+  return projection;
+}
+
+uint32_t
+QuotientGroup::multiply(uint32_t lhs_coset, uint32_t rhs_coset) const
+{
+  uint32_t cosets = representatives.size();
+
+  if (lhs_coset >= cosets || rhs_coset >= cosets)
+    {
+      GroupError e(GrpErr_IndexOutOfBounds);
+      throw e;
+    }
+  return table[lhs_coset * cosets + rhs_coset];
+}
+
+uint32_t
+QuotientGroup::inverse(uint32_t coset) const
+{
+  if (coset >= inverses.size())
+    {
+      GroupError e(GrpErr_IndexOutOfBounds);
+      throw e;
+    }
+  return inverses[coset];
+}
+
+uint32_t
+QuotientGroup::get_identity(void) const
+{
+  return 0;
+}
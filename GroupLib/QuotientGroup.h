@@ -0,0 +1,84 @@
+/******************************************************************************/
+/*                                                                            */
+/*  QuotientGroup.h Definitions for factor groups G/N                         */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef QUOTIENT_GROUP_H__
+#define QUOTIENT_GROUP_H__
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+
+// The factor group G/N.  Cosets are numbered 0..size()-1 with the
+// coset N itself as 0, which is therefore the identity.
+class QuotientGroup
+{
+ public:
+  QuotientGroup();
+  ~QuotientGroup();
+
+  friend std::ostream &operator <<(std::ostream &output, QuotientGroup &Q)
+  {
+    for (uint32_t idx = 0; idx < Q.representatives.size(); idx++)
+      {
+        output << "<" << Q.representatives[idx] << "N>";
+      }
+    return output;
+  }
+
+  // Builds G/N, failing with GrpErr_NotNormalSubgroup if N is not
+  // normal in G
+  GrpErr_t generate(Group &G, Group &N);
+  void clear(void);
+
+  // The number of cosets, [G:N]
+  uint32_t size(void) const;
+
+  // Representative of the coset, the first element of G in it
+  bool get_representative(uint32_t coset, GroupElement &e) const;
+
+  // Projection G -> G/N by element index of G
+  uint32_t project(uint32_t element_index) const;
+  const std::vector<uint32_t> &get_projection(void) const;
+
+  // Product table lookups
+  uint32_t multiply(uint32_t lhs_coset, uint32_t rhs_coset) const;
+  uint32_t inverse(uint32_t coset) const;
+  uint32_t get_identity(void) const;
+
+ private:
+  std::vector<uint32_t> projection;
+  std::vector<GroupElement> representatives;
+
+  // size() x size() product table, row major
+  std::vector<uint32_t> table;
+  std::vector<uint32_t> inverses;
+};
+
+#endif // QUOTIENT_GROUP_H__
@@ -0,0 +1,362 @@
+/******************************************************************************/
+/*                                                                            */
+/*  RandomElements.cpp: Random elements of groups too big to list             */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "ParallelStream.h"
+#include "RandomElements.h"
+
+static uint64_t
+splitmix64(uint64_t &x)
+{
+  uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+SampleRng::SampleRng(uint64_t seed, uint32_t stream)
+{
+  this->seed(seed, stream);
+}
+
+void
+SampleRng::seed(uint64_t seed, uint32_t stream)
+{
+  for (uint32_t k = 0; k < 4; k++)
+    {
+      state[k] = splitmix64(seed);
+    }
+  for (uint32_t s = 0; s < stream; s++)
+    {
+      jump();
+    }
+}
+
+void
+SampleRng::jump(void)
+{
+  static const uint64_t jump_polynomial[4] =
+    {
+      0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+      0xa9582618e03fc9aaull, 0x39abdc4529b1661cull
+    };
+  uint64_t jumped[4] = {0, 0, 0, 0};
+
+  for (uint32_t w = 0; w < 4; w++)
+    {
+      for (uint32_t b = 0; b < 64; b++)
+        {
+          if (jump_polynomial[w] & (1ull << b))
+            {
+              for (uint32_t k = 0; k < 4; k++)
+                {
+                  jumped[k] ^= state[k];
+                }
+            }
+          next();
+        }
+    }
+  memcpy(state, jumped, sizeof(state));
+}
+
+ProductReplacement::ProductReplacement()
+{
+  element_order = 0;
+}
+
+ProductReplacement::~ProductReplacement()
+{
+}
+
+GrpErr_t
+ProductReplacement::generate(const std::vector<GroupElement> &generators,
+                             uint64_t seed, uint32_t stream,
+                             uint32_t warmup, uint32_t slot_count)
+{
+  element_order = 0;
+  slots.clear();
+  if (generators.empty() || generators[0].get_order() == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  for (uint32_t idx = 1; idx < generators.size(); idx++)
+    {
+      if (generators[idx].get_order() != generators[0].get_order())
+        {
+          return GrpErr_OrderMismatch;
+        }
+    }
+
+  element_order = generators[0].get_order();
+  slot_count = std::max<uint32_t>(std::max<uint32_t>(slot_count, 2),
+                                  generators.size());
+  slots.resize(slot_count);
+  for (uint32_t idx = 0; idx < slot_count; idx++)
+    {
+      memcpy(slots[idx].value, generators[idx % generators.size()].get_element().data(),
+             element_order);
+    }
+  for (uint32_t i = 0; i < element_order; i++)
+    {
+      accumulator.value[i] = '0' + i;
+    }
+
+  rng.seed(seed, stream);
+  for (uint32_t idx = 0; idx < warmup; idx++)
+    {
+      step();
+    }
+  return GrpErr_OK;
+}
+
+uint32_t
+ProductReplacement::get_element_order(void) const
+{
+  return element_order;
+}
+
+void
+ProductReplacement::step(void)
+{
+  uint32_t count = slots.size();
+  uint32_t i = rng.below(count);
+  uint32_t j = rng.below(count - 1);
+  uint64_t flags = rng.next();
+  char other[max_order];
+  char product[max_order];
+
+  if (j >= i)
+    {
+      j++;
+    }
+
+  const char *y = slots[j].value;
+  char *x = slots[i].value;
+
+  if (flags & 1)
+    {
+      for (uint32_t k = 0; k < element_order; k++)
+        {
+          other[y[k] - '0'] = '0' + k;
+        }
+      y = other;
+    }
+  if (flags & 2)
+    {
+      for (uint32_t k = 0; k < element_order; k++)
+        {
+          product[k] = y[x[k] - '0'];
+        }
+    }
+  else
+    {
+      for (uint32_t k = 0; k < element_order; k++)
+        {
+          product[k] = x[y[k] - '0'];
+        }
+    }
+  memcpy(x, product, element_order);
+
+  for (uint32_t k = 0; k < element_order; k++)
+    {
+      product[k] = accumulator.value[x[k] - '0'];
+    }
+  memcpy(accumulator.value, product, element_order);
+}
+
+void
+ProductReplacement::next(char *value)
+{
+  step();
+  memcpy(value, accumulator.value, element_order);
+}
+
+GrpErr_t
+ProductReplacement::next(GroupElement &e)
+{
+  char value[max_order];
+
+  if (element_order == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  next(value);
+  e.set_order(element_order);
+  e.set_element(std::string(value, element_order));
+  return GrpErr_OK;
+}
+
+UniformSampler::UniformSampler()
+{
+  group_type = GrpGen_Unknown;
+  element_order = 0;
+  ranks = 0;
+}
+
+UniformSampler::~UniformSampler()
+{
+}
+
+GrpErr_t
+UniformSampler::generate(GrpGen_t type, uint32_t order, uint64_t seed,
+                         uint32_t stream)
+{
+  group_type = GrpGen_Unknown;
+  element_order = 0;
+  ranks = 0;
+
+  if (order == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  if (order > max_order)
+    {
+      return GrpErr_ElementOverflow;
+    }
+
+  switch (type)
+    {
+    case GrpGen_Sn:
+    case GrpGen_An:
+      ranks = permutation_count(order);
+      break;
+    case GrpGen_Dn:
+      ranks = 2 * order;
+      break;
+    case GrpGen_Cn:
+      ranks = order;
+      break;
+    default:
+      return GrpErr_UnimplimentedFunction;
+    }
+
+  group_type = type;
+  element_order = order;
+  rng.seed(seed, stream);
+  return GrpErr_OK;
+}
+
+uint32_t
+UniformSampler::get_element_order(void) const
+{
+  return element_order;
+}
+
+uint64_t
+UniformSampler::size(void) const
+{
+  switch (group_type)
+    {
+    case GrpGen_An:
+      return element_order < 2 ? 1 : ranks / 2;
+    case GrpGen_Dn:
+      // D1 and D2 are a point and a segment, whose reflections repeat
+      return element_order < 3 ? element_order : ranks;
+    default:
+      return ranks;
+    }
+}
+
+void
+UniformSampler::next(char *value)
+{
+  uint32_t order = element_order;
+
+  switch (group_type)
+    {
+    case GrpGen_Cn:
+      {
+        uint32_t step = rng.below(ranks);
+
+        for (uint32_t i = 0; i < order; i++)
+          {
+            value[i] = '0' + (step + i) % order;
+          }
+      }
+      break;
+
+    case GrpGen_Dn:
+      {
+        // i -> step + i, or step - i for a reflection
+        uint32_t rank = rng.below(ranks);
+        uint32_t step = rank >> 1;
+
+        for (uint32_t i = 0; i < order; i++)
+          {
+            value[i] = '0' + ((rank & 1) ? (step + order - i) : (step + i)) % order;
+          }
+      }
+      break;
+
+    default:
+      {
+        // A uniform rank has independent uniform mixed radix digits, so
+        // they are drawn one at a time and unranked in Myrvold and
+        // Ruskey's order, a swap per digit.  Every swap that moves
+        // anything changes the parity.
+        uint32_t swaps = 0;
+
+        for (uint32_t i = 0; i < order; i++)
+          {
+            value[i] = '0' + i;
+          }
+        for (uint32_t i = 0; i + 1 < order; i++)
+          {
+            uint32_t j = i + rng.below(order - i);
+
+            std::swap(value[i], value[j]);
+            swaps += (j != i);
+          }
+        if (group_type == GrpGen_An && (swaps & 1) != 0)
+          {
+            std::swap(value[0], value[1]);
+          }
+      }
+      break;
+    }
+}
+
+GrpErr_t
+UniformSampler::next(GroupElement &e)
+{
+  char value[max_order];
+
+  if (element_order == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  next(value);
+  e.set_order(element_order);
+  e.set_element(std::string(value, element_order));
+  return GrpErr_OK;
+}
@@ -0,0 +1,155 @@
+/******************************************************************************/
+/*                                                                            */
+/*  RandomElements.h Random elements of groups too big to list                */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef RANDOM_ELEMENTS_H__
+#define RANDOM_ELEMENTS_H__
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+#include "Group.h"
+
+// xoshiro256** seeded through splitmix64.  The streams of one seed start
+// 2^128 draws apart, so each thread can take its own.
+class SampleRng
+{
+ public:
+  SampleRng(uint64_t seed = 0, uint32_t stream = 0);
+
+  void seed(uint64_t seed, uint32_t stream = 0);
+  // Moves on 2^128 draws
+  void jump(void);
+
+  uint64_t next(void)
+  {
+    uint64_t result = rotate(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotate(state[3], 45);
+    return result;
+  }
+
+  // Uniform on [0, bound) by Lemire's multiply and reject
+  uint64_t below(uint64_t bound)
+  {
+    unsigned __int128 product = static_cast<unsigned __int128>(next()) * bound;
+    uint64_t low = static_cast<uint64_t>(product);
+
+    if (low < bound)
+      {
+        uint64_t threshold = -bound % bound;
+
+        while (low < threshold)
+          {
+            product = static_cast<unsigned __int128>(next()) * bound;
+            low = static_cast<uint64_t>(product);
+          }
+      }
+    return product >> 64;
+  }
+
+ private:
+  static uint64_t rotate(uint64_t x, uint32_t k)
+  {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  uint64_t state[4];
+};
+
+// Slots and warm up steps recommended for product replacement
+const uint32_t default_replacement_slots = 10;
+const uint32_t default_replacement_warmup = 100;
+
+// Product replacement with an accumulator ("rattle"): a random slot is
+// multiplied by another or its inverse on a random side, the accumulator
+// by the new slot, and the accumulator is the sample.  Close to uniform
+// for any generating set once warmed up, though not exactly.
+class ProductReplacement
+{
+ public:
+  ProductReplacement();
+  ~ProductReplacement();
+
+  GrpErr_t generate(const std::vector<GroupElement> &generators,
+                    uint64_t seed, uint32_t stream = 0,
+                    uint32_t warmup = default_replacement_warmup,
+                    uint32_t slots = default_replacement_slots);
+
+  uint32_t get_element_order(void) const;
+  // value holds get_element_order() characters
+  void next(char *value);
+  GrpErr_t next(GroupElement &e);
+
+ private:
+  void step(void);
+
+  typedef struct
+  {
+    char value[max_order];
+  } Slot;
+
+  uint32_t element_order;
+  std::vector<Slot> slots;
+  Slot accumulator;
+  SampleRng rng;
+};
+
+// Exactly uniform elements of Sn, An, Dn or Cn drawn as a random rank
+// and unranked, for Sn a digit at a time.  An takes an Sn element and
+// swaps its first two values when it is odd, which pairs the odd and
+// even elements one to one.
+class UniformSampler
+{
+ public:
+  UniformSampler();
+  ~UniformSampler();
+
+  GrpErr_t generate(GrpGen_t type, uint32_t order, uint64_t seed,
+                    uint32_t stream = 0);
+
+  uint32_t get_element_order(void) const;
+  // The number of elements sampled from
+  uint64_t size(void) const;
+  void next(char *value);
+  GrpErr_t next(GroupElement &e);
+
+ private:
+  GrpGen_t group_type;
+  uint32_t element_order;
+  uint64_t ranks;
+  SampleRng rng;
+};
+
+#endif // RANDOM_ELEMENTS_H__
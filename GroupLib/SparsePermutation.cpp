@@ -0,0 +1,361 @@
+/******************************************************************************/
+/*                                                                            */
+/*  SparsePermutation.cpp: Permutations of large degree that move few points  */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SparsePermutation.h"
+
+SparsePermutation::SparsePermutation()
+{
+  degree = 0;
+}
+
+SparsePermutation::SparsePermutation(uint32_t degree)
+{
+  this->degree = degree;
+}
+
+SparsePermutation::~SparsePermutation()
+{
+}
+
+GrpErr_t
+SparsePermutation::set_moves(uint32_t degree,
+                             const std::vector<Move_t> &moves)
+{
+  std::vector<Move_t> sorted;
+  std::vector<uint32_t> targets;
+
+  for (size_t idx = 0; idx < moves.size(); idx++)
+    {
+      if (moves[idx].first >= degree || moves[idx].second >= degree)
+        {
+          return GrpErr_ElementValueOutOfRange;
+        }
+      // Fixed points are not kept
+      if (moves[idx].first != moves[idx].second)
+        {
+          sorted.push_back(moves[idx]);
+          targets.push_back(moves[idx].second);
+        }
+    }
+  std::sort(sorted.begin(), sorted.end());
+  std::sort(targets.begin(), targets.end());
+
+  // The images must be the moved points again, each exactly once
+  for (size_t idx = 1; idx < sorted.size(); idx++)
+    {
+      if (sorted[idx].first == sorted[idx - 1].first
+          || targets[idx] == targets[idx - 1])
+        {
+          return GrpErr_ElementValueDuplicated;
+        }
+    }
+  for (size_t idx = 0; idx < sorted.size(); idx++)
+    {
+      if (targets[idx] != sorted[idx].first)
+        {
+          return GrpErr_ElementValueMissing;
+        }
+    }
+
+  this->degree = degree;
+  points.resize(sorted.size());
+  images.resize(sorted.size());
+  for (size_t idx = 0; idx < sorted.size(); idx++)
+    {
+      points[idx] = sorted[idx].first;
+      images[idx] = sorted[idx].second;
+    }
+  return GrpErr_OK;
+}
+
+GrpErr_t
+SparsePermutation::set_cycles(uint32_t degree,
+                              const std::vector<std::vector<uint32_t> > &cycles)
+{
+  std::vector<Move_t> moves;
+
+  for (size_t c = 0; c < cycles.size(); c++)
+    {
+      const std::vector<uint32_t> &cycle = cycles[c];
+
+      for (size_t idx = 0; cycle.size() > 1 && idx < cycle.size(); idx++)
+        {
+          moves.push_back(Move_t(cycle[idx], cycle[(idx + 1) % cycle.size()]));
+        }
+    }
+  return set_moves(degree, moves);
+}
+
+GrpErr_t
+SparsePermutation::set_element(const GroupElement &element)
+{
+  std::string value = element.get_element();
+  std::vector<Move_t> moves;
+
+  for (uint32_t i = 0; i < value.size(); i++)
+    {
+      if (static_cast<uint32_t>(value[i] - '0') != i)
+        {
+          moves.push_back(Move_t(i, value[i] - '0'));
+        }
+    }
+  return set_moves(value.size(), moves);
+}
+
+GrpErr_t
+SparsePermutation::to_element(GroupElement &element) const
+{
+  if (degree == 0)
+    {
+      return GrpErr_UndefinedGroupOrder;
+    }
+  if (degree > max_order)
+    {
+      return GrpErr_ElementOverflow;
+    }
+
+  std::string value(degree, '0');
+
+  for (uint32_t i = 0; i < degree; i++)
+    {
+      value[i] = i + '0';
+    }
+  for (size_t idx = 0; idx < points.size(); idx++)
+    {
+      value[points[idx]] = images[idx] + '0';
+    }
+  element.set_order(degree);
+  element.set_element(value);
+  return GrpErr_OK;
+}
+
+// A binary search whose halving compiles to a conditional move, so the
+// random probes of a product do not cost a mispredicted branch each
+size_t
+SparsePermutation::position(uint32_t point) const
+{
+  if (points.empty())
+    {
+      return 0;
+    }
+
+  const uint32_t *base = points.data();
+  size_t count = points.size();
+
+  while (count > 1)
+    {
+      size_t half = count / 2;
+
+      base = (base[half] < point) ? base + half : base;
+      count -= half;
+    }
+  return (base - points.data()) + (*base < point);
+}
+
+uint32_t
+SparsePermutation::get_image(uint32_t point) const
+{
+  size_t idx = position(point);
+
+  if (idx < points.size() && points[idx] == point)
+    {
+      return images[idx];
+    }
+  return point;
+}
+
+// Only points moved by one side or the other can move in the product, so
+// the two lists are merged.  The lhs images are looked up through a small
+// open addressed table built for the call, a probe or two each.
+SparsePermutation
+SparsePermutation::operator *(const SparsePermutation &rhs) const
+{
+  if (degree != rhs.degree)
+    {
+      GroupError e(GrpErr_IncompatibleGroupElement);
+      throw e;
+    }
+
+  const uint32_t empty = UINT32_MAX;
+  size_t slots = 8;
+
+  while (slots < 2 * points.size())
+    {
+      slots *= 2;
+    }
+
+  std::vector<uint32_t> keys(slots, empty);
+  std::vector<uint32_t> values(slots);
+  size_t mask = slots - 1;
+
+  for (size_t idx = 0; idx < points.size(); idx++)
+    {
+      size_t slot = (points[idx] * 2654435761u) & mask;
+
+      while (keys[slot] != empty)
+        {
+          slot = (slot + 1) & mask;
+        }
+      keys[slot] = points[idx];
+      values[slot] = images[idx];
+    }
+
+  SparsePermutation product(degree);
+  size_t l = 0;
+  size_t r = 0;
+
+  product.points.reserve(points.size() + rhs.points.size());
+  product.images.reserve(points.size() + rhs.points.size());
+  while (l < points.size() || r < rhs.points.size())
+    {
+      uint32_t point;
+      uint32_t image;
+
+      if (r == rhs.points.size()
+          || (l < points.size() && points[l] < rhs.points[r]))
+        {
+          // Fixed by rhs
+          point = points[l];
+          image = images[l];
+          l++;
+        }
+      else
+        {
+          point = rhs.points[r];
+          if (l < points.size() && points[l] == point)
+            {
+              l++;
+            }
+
+          uint32_t middle = rhs.images[r];
+          size_t slot = (middle * 2654435761u) & mask;
+
+          while (keys[slot] != empty && keys[slot] != middle)
+            {
+              slot = (slot + 1) & mask;
+            }
+          image = (keys[slot] == middle) ? values[slot] : middle;
+          r++;
+        }
+
+      if (image != point)
+        {
+          product.points.push_back(point);
+          product.images.push_back(image);
+        }
+    }
+  return product;
+}
+
+bool
+SparsePermutation::operator ==(const SparsePermutation &rhs) const
+{
+  return degree == rhs.degree && points == rhs.points && images == rhs.images;
+}
+
+bool
+SparsePermutation::operator !=(const SparsePermutation &rhs) const
+{
+  return !(*this == rhs);
+}
+
+SparsePermutation
+SparsePermutation::inverse(void) const
+{
+  std::vector<Move_t> swapped(points.size());
+  SparsePermutation result(degree);
+
+  for (size_t idx = 0; idx < points.size(); idx++)
+    {
+      swapped[idx] = Move_t(images[idx], points[idx]);
+    }
+  std::sort(swapped.begin(), swapped.end());
+
+  result.points.resize(points.size());
+  result.images.resize(points.size());
+  for (size_t idx = 0; idx < swapped.size(); idx++)
+    {
+      result.points[idx] = swapped[idx].first;
+      result.images[idx] = swapped[idx].second;
+    }
+  return result;
+}
+
+// A cycle of length k is k - 1 transpositions, so the parity is that of
+// the support less the number of cycles
+bool
+SparsePermutation::is_odd(void) const
+{
+  std::vector<bool> seen(points.size(), false);
+  size_t cycles = 0;
+
+  for (size_t idx = 0; idx < points.size(); idx++)
+    {
+      if (seen[idx])
+        {
+          continue;
+        }
+      cycles++;
+      for (size_t pos = idx; !seen[pos]; pos = position(images[pos]))
+        {
+          seen[pos] = true;
+        }
+    }
+  return ((points.size() - cycles) & 1) != 0;
+}
+
+std::ostream &
+operator <<(std::ostream &output, const SparsePermutation &p)
+{
+  std::vector<bool> seen(p.points.size(), false);
+
+  if (p.points.empty())
+    {
+      output << "()";
+    }
+  for (size_t idx = 0; idx < p.points.size(); idx++)
+    {
+      if (seen[idx])
+        {
+          continue;
+        }
+      output << "(" << p.points[idx];
+      seen[idx] = true;
+      for (size_t pos = p.position(p.images[idx]); !seen[pos];
+           pos = p.position(p.images[pos]))
+        {
+          seen[pos] = true;
+          output << " " << p.points[pos];
+        }
+      output << ")";
+    }
+  return output;
+}
@@ -0,0 +1,94 @@
+/******************************************************************************/
+/*                                                                            */
+/*  SparsePermutation.h Permutations of large degree that move few points     */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef SPARSE_PERMUTATION_H__
+#define SPARSE_PERMUTATION_H__
+
+#include <stdint.h>
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+
+// A permutation of 0 .. degree - 1 kept as the sorted list of the points
+// it moves and their images.  Every other point is fixed, so the cost of
+// an operation follows the support, the number of moved points, and not
+// the degree, which may be far beyond max_order.  The products follow
+// GroupElement: (a * b)[i] = a[b[i]].
+class SparsePermutation
+{
+ public:
+  typedef std::pair<uint32_t, uint32_t> Move_t;
+
+  // The identity of the given degree
+  SparsePermutation();
+  explicit SparsePermutation(uint32_t degree);
+  ~SparsePermutation();
+
+  // point -> image for each moved point, in any order.  They must form a
+  // permutation of the points listed.
+  GrpErr_t set_moves(uint32_t degree, const std::vector<Move_t> &moves);
+  // Each cycle a list of points, c[0] -> c[1] -> ... -> c[0]
+  GrpErr_t set_cycles(uint32_t degree,
+                      const std::vector<std::vector<uint32_t> > &cycles);
+
+  // Dense to sparse and back.  to_element reports GrpErr_ElementOverflow
+  // when the degree is more than a GroupElement holds.
+  GrpErr_t set_element(const GroupElement &element);
+  GrpErr_t to_element(GroupElement &element) const;
+
+  uint32_t get_degree(void) const { return degree; }
+  uint32_t get_support(void) const { return points.size(); }
+  // The moved points in increasing order and their images
+  const std::vector<uint32_t> &get_points(void) const { return points; }
+  const std::vector<uint32_t> &get_images(void) const { return images; }
+  uint32_t get_image(uint32_t point) const;
+
+  SparsePermutation operator *(const SparsePermutation &rhs) const;
+  bool operator ==(const SparsePermutation &rhs) const;
+  bool operator !=(const SparsePermutation &rhs) const;
+  SparsePermutation inverse(void) const;
+  bool is_odd(void) const;
+  bool is_identity(void) const { return points.empty(); }
+
+  // Cycle notation over the moved points, "()" for the identity
+  friend std::ostream &operator <<(std::ostream &output,
+                                   const SparsePermutation &p);
+
+ private:
+  // Where point is or would go in points
+  size_t position(uint32_t point) const;
+
+  uint32_t degree;
+  // Sorted, fixed points left out; images[k] is where points[k] goes
+  std::vector<uint32_t> points;
+  std::vector<uint32_t> images;
+};
+
+#endif // SPARSE_PERMUTATION_H__
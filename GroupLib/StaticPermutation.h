@@ -0,0 +1,372 @@
+/******************************************************************************/
+/*                                                                            */
+/*  StaticPermutation.h Permutations and Cayley tables of fixed degree        */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef STATIC_PERMUTATION_H__
+#define STATIC_PERMUTATION_H__
+
+#include <stdint.h>
+
+#include <string>
+
+#include "GroupError.h"
+#include "GroupElement.h"
+
+// A permutation whose degree N is fixed at compile time.  It follows the
+// GroupElement conventions, (a * b)[i] = a[b[i]], but everything is
+// constexpr and the loops have constant bounds, so small groups can be
+// worked out entirely by the compiler.
+template <uint32_t N>
+class StaticPermutation
+{
+  static_assert(N > 0 && N <= max_order, "degree out of range");
+
+ public:
+  // The identity
+  constexpr StaticPermutation() : image()
+  {
+    for (uint32_t idx = 0; idx < N; idx++)
+      {
+        image[idx] = static_cast<uint8_t>(idx);
+      }
+  }
+
+  // From an element value such as "1230"; the value is not checked
+  constexpr StaticPermutation(const char (&value)[N + 1]) : image()
+  {
+    for (uint32_t idx = 0; idx < N; idx++)
+      {
+        image[idx] = static_cast<uint8_t>(value[idx] - '0');
+      }
+  }
+
+  constexpr uint8_t operator [](uint32_t idx) const
+  {
+    return image[idx];
+  }
+
+  constexpr StaticPermutation operator *(const StaticPermutation &rhs) const
+  {
+    StaticPermutation product;
+
+    for (uint32_t idx = 0; idx < N; idx++)
+      {
+        product.image[idx] = image[rhs.image[idx]];
+      }
+    return product;
+  }
+
+  constexpr bool operator ==(const StaticPermutation &rhs) const
+  {
+    for (uint32_t idx = 0; idx < N; idx++)
+      {
+        if (image[idx] != rhs.image[idx])
+          {
+            return false;
+          }
+      }
+    return true;
+  }
+
+  constexpr bool operator !=(const StaticPermutation &rhs) const
+  {
+    return !(*this == rhs);
+  }
+
+  // Lexicographic, the order of the Group element indices
+  constexpr bool operator <(const StaticPermutation &rhs) const
+  {
+    for (uint32_t idx = 0; idx < N; idx++)
+      {
+        if (image[idx] != rhs.image[idx])
+          {
+            return image[idx] < rhs.image[idx];
+          }
+      }
+    return false;
+  }
+
+  constexpr StaticPermutation inverse(void) const
+  {
+    StaticPermutation result;
+
+    for (uint32_t idx = 0; idx < N; idx++)
+      {
+        result.image[image[idx]] = static_cast<uint8_t>(idx);
+      }
+    return result;
+  }
+
+  // An odd permutation has an odd number of even length cycles
+  constexpr bool is_odd(void) const
+  {
+    bool seen[N] = {};
+    uint32_t cycles = 0;
+
+    for (uint32_t idx = 0; idx < N; idx++)
+      {
+        if (!seen[idx])
+          {
+            cycles++;
+            for (uint32_t pos = idx; !seen[pos]; pos = image[pos])
+              {
+                seen[pos] = true;
+              }
+          }
+      }
+    return ((N - cycles) & 1) != 0;
+  }
+
+  // The lcm of the cycle lengths
+  constexpr uint64_t order(void) const
+  {
+    bool seen[N] = {};
+    uint64_t result = 1;
+
+    for (uint32_t idx = 0; idx < N; idx++)
+      {
+        uint64_t length = 0;
+
+        for (uint32_t pos = idx; !seen[pos]; pos = image[pos])
+          {
+            seen[pos] = true;
+            length++;
+          }
+        if (length > 1)
+          {
+            uint64_t a = result;
+            uint64_t b = length;
+
+            while (b != 0)
+              {
+                uint64_t t = a % b;
+
+                a = b;
+                b = t;
+              }
+            result = result / a * length;
+          }
+      }
+    return result;
+  }
+
+  std::string get_value(void) const
+  {
+    std::string value(N, '0');
+
+    for (uint32_t idx = 0; idx < N; idx++)
+      {
+        value[idx] = static_cast<char>('0' + image[idx]);
+      }
+    return value;
+  }
+
+  GroupElement to_element(void) const
+  {
+    GroupElement element;
+
+    element.set_order(N);
+    element.set_element(get_value());
+    return element;
+  }
+
+ private:
+  uint8_t image[N];
+};
+
+// The Cayley table of a group of Size elements of degree N.  The elements
+// are in lexicographic order, so the indices and products agree with a
+// Group and its CayleyTable built from the same group.
+template <uint32_t N, uint32_t Size>
+struct StaticCayleyTable
+{
+  static_assert(Size > 0 && Size <= 256, "table indices are bytes");
+
+  StaticPermutation<N> elements[Size];
+  uint8_t products[Size][Size];
+
+  constexpr uint32_t size(void) const
+  {
+    return Size;
+  }
+
+  constexpr uint32_t product(uint32_t row, uint32_t column) const
+  {
+    return products[row][column];
+  }
+
+  // The index of p, or Size when p is not in the group
+  constexpr uint32_t find(const StaticPermutation<N> &p) const
+  {
+    uint32_t low = 0;
+    uint32_t high = Size;
+
+    while (low < high)
+      {
+        uint32_t mid = (low + high) / 2;
+
+        if (elements[mid] < p)
+          {
+            low = mid + 1;
+          }
+        else
+          {
+            high = mid;
+          }
+      }
+    return (low < Size && elements[low] == p) ? low : Size;
+  }
+};
+
+// Closes the generators under multiplication, sorts the elements and fills
+// in the products.  Size must be the order of the generated group.
+template <uint32_t N, uint32_t Size, uint32_t Count>
+constexpr StaticCayleyTable<N, Size>
+make_static_table(const StaticPermutation<N> (&generators)[Count])
+{
+  StaticCayleyTable<N, Size> table = {};
+  uint32_t found = 1;
+
+  table.elements[0] = StaticPermutation<N>();
+  for (uint32_t idx = 0; idx < found; idx++)
+    {
+      for (uint32_t gen = 0; gen < Count; gen++)
+        {
+          StaticPermutation<N> next = table.elements[idx] * generators[gen];
+          bool known = false;
+
+          for (uint32_t seen = 0; seen < found && !known; seen++)
+            {
+              known = (table.elements[seen] == next);
+            }
+          if (!known)
+            {
+              // More elements than Size means Size is wrong
+              if (found == Size)
+                {
+                  throw GroupError(GrpErr_OrderMismatch);
+                }
+              table.elements[found++] = next;
+            }
+        }
+    }
+  if (found != Size)
+    {
+      throw GroupError(GrpErr_OrderMismatch);
+    }
+
+  for (uint32_t idx = 1; idx < Size; idx++)
+    {
+      StaticPermutation<N> key = table.elements[idx];
+      uint32_t pos = idx;
+
+      for (; pos > 0 && key < table.elements[pos - 1]; pos--)
+        {
+          table.elements[pos] = table.elements[pos - 1];
+        }
+      table.elements[pos] = key;
+    }
+
+  for (uint32_t row = 0; row < Size; row++)
+    {
+      for (uint32_t column = 0; column < Size; column++)
+        {
+          table.products[row][column] = static_cast<uint8_t>(
+            table.find(table.elements[row] * table.elements[column]));
+        }
+    }
+  return table;
+}
+
+// The rotation i -> i + 1 of a polygon with N vertices
+template <uint32_t N>
+constexpr StaticPermutation<N>
+static_rotation(void)
+{
+  char value[N + 1] = {};
+
+  for (uint32_t idx = 0; idx < N; idx++)
+    {
+      value[idx] = static_cast<char>('0' + (idx + 1) % N);
+    }
+  return StaticPermutation<N>(value);
+}
+
+// The reflection i -> -i of a polygon with N vertices
+template <uint32_t N>
+constexpr StaticPermutation<N>
+static_reflection(void)
+{
+  char value[N + 1] = {};
+
+  for (uint32_t idx = 0; idx < N; idx++)
+    {
+      value[idx] = static_cast<char>('0' + (N - idx) % N);
+    }
+  return StaticPermutation<N>(value);
+}
+
+template <uint32_t N>
+constexpr StaticCayleyTable<N, N>
+make_Cn_table(void)
+{
+  const StaticPermutation<N> generators[1] = { static_rotation<N>() };
+
+  return make_static_table<N, N>(generators);
+}
+
+template <uint32_t N>
+constexpr StaticCayleyTable<N, 2 * N>
+make_Dn_table(void)
+{
+  static_assert(N >= 3, "a polygon needs three vertices");
+  const StaticPermutation<N> generators[2] = { static_rotation<N>(),
+                                               static_reflection<N>() };
+
+  return make_static_table<N, 2 * N>(generators);
+}
+
+constexpr StaticCayleyTable<4, 24>
+make_S4_table(void)
+{
+  // The transposition and the 4-cycle, as generate_Sn records
+  const StaticPermutation<4> generators[2] = { StaticPermutation<4>("1023"),
+                                               StaticPermutation<4>("1230") };
+
+  return make_static_table<4, 24>(generators);
+}
+
+constexpr StaticCayleyTable<5, 60>
+make_A5_table(void)
+{
+  // The 3-cycles (0 1 i), as generate_An records
+  const StaticPermutation<5> generators[3] = { StaticPermutation<5>("12034"),
+                                               StaticPermutation<5>("13204"),
+                                               StaticPermutation<5>("14230") };
+
+  return make_static_table<5, 60>(generators);
+}
+
+#endif // STATIC_PERMUTATION_H__
@@ -0,0 +1,273 @@
+/******************************************************************************/
+/*                                                                            */
+/*  TableWriter.cpp: Writing Cayley tables in bulk                            */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "CycleNotation.h"
+#include "TableWriter.h"
+
+const char binary_table_magic[8] = {'C', 'A', 'Y', 'L', 'E', 'Y', 'T', '1'};
+
+// Output is gathered here and written a block at a time
+const size_t output_block = 1 << 20;
+
+class OutputBuffer
+{
+ public:
+  OutputBuffer(int fd) : fd(fd), used(0), failed(false)
+  {
+    buffer.resize(output_block);
+  }
+
+  void put(const char *data, size_t length)
+  {
+    while (length > 0)
+      {
+        if (used == buffer.size())
+          {
+            flush();
+          }
+
+        size_t part = std::min(length, buffer.size() - used);
+
+        memcpy(&buffer[used], data, part);
+        used += part;
+        data += part;
+        length -= part;
+      }
+  }
+
+  void put(const std::string &text)
+  {
+    put(text.data(), text.size());
+  }
+
+  void put(char c)
+  {
+    if (used == buffer.size())
+      {
+        flush();
+      }
+    buffer[used++] = c;
+  }
+
+  void put_decimal(uint32_t number)
+  {
+    char digits[10];
+    size_t count = 0;
+
+    do
+      {
+        digits[count++] = '0' + number % 10;
+        number /= 10;
+      } while (number != 0);
+
+    if (buffer.size() - used < count)
+      {
+        flush();
+      }
+    while (count > 0)
+      {
+        buffer[used++] = digits[--count];
+      }
+  }
+
+  void flush(void)
+  {
+    size_t done = 0;
+
+    while (done < used && !failed)
+      {
+        ssize_t written = ::write(fd, &buffer[done], used - done);
+
+        if (written < 0 && errno == EINTR)
+          {
+            continue;
+          }
+        if (written <= 0)
+          {
+            failed = true;
+            break;
+          }
+        done += written;
+      }
+    used = 0;
+  }
+
+  bool ok(void) const { return !failed; }
+
+ private:
+  int fd;
+  std::vector<char> buffer;
+  size_t used;
+  bool failed;
+};
+
+static void
+write_labelled(const CayleyTable &table, OutputBuffer &out,
+               const std::vector<std::string> &labels, bool padded,
+               const char *separator)
+{
+  uint32_t size = table.size();
+  size_t separator_length = strlen(separator);
+  size_t width = 0;
+
+  for (uint32_t idx = 0; idx < size; idx++)
+    {
+      width = std::max(width, labels[idx].size());
+    }
+
+  std::string blank(width, ' ');
+  std::vector<std::string> cells(labels);
+
+  if (padded)
+    {
+      for (uint32_t idx = 0; idx < size; idx++)
+        {
+          cells[idx].resize(width, ' ');
+        }
+    }
+
+  out.put(padded ? blank : std::string());
+  for (uint32_t column = 0; column < size; column++)
+    {
+      out.put(separator, separator_length);
+      out.put(cells[column]);
+    }
+  out.put('\n');
+
+  for (uint32_t row = 0; row < size; row++)
+    {
+      const uint32_t *products = table.get_row(row);
+
+      out.put(cells[row]);
+      for (uint32_t column = 0; column < size; column++)
+        {
+          out.put(separator, separator_length);
+          out.put(cells[products[column]]);
+        }
+      out.put('\n');
+    }
+}
+
+GrpErr_t
+write_cayley_table(Group &G, const CayleyTable &table, int fd,
+                   GrpTblFormat_t format, bool cycles)
+{
+  uint32_t size = table.size();
+  uint32_t order = G.get_element_order();
+
+  if (size == 0 || size != G.size())
+    {
+      return GrpErr_OrderMismatch;
+    }
+
+  const char *values = G.get_packed_values();
+  OutputBuffer out(fd);
+
+  if (format == GrpTblFormat_Binary)
+    {
+      out.put(binary_table_magic, sizeof(binary_table_magic));
+      out.put(reinterpret_cast<const char *>(&size), sizeof(size));
+      out.put(reinterpret_cast<const char *>(&order), sizeof(order));
+      out.put(values, static_cast<size_t>(size) * order);
+      for (uint32_t row = 0; row < size; row++)
+        {
+          out.put(reinterpret_cast<const char *>(table.get_row(row)),
+                  static_cast<size_t>(size) * sizeof(uint32_t));
+        }
+      out.flush();
+      return out.ok() ? GrpErr_OK : GrpErr_FileAccess;
+    }
+
+  std::vector<std::string> labels(size);
+
+  for (uint32_t idx = 0; idx < size; idx++)
+    {
+      const char *value = values + static_cast<size_t>(idx) * order;
+
+      if (cycles)
+        {
+          char text[max_cycle_text];
+
+          labels[idx].assign(text, format_cycle_value(value, order, text));
+        }
+      else
+        {
+          labels[idx].assign(value, order);
+        }
+    }
+
+  switch (format)
+    {
+    case GrpTblFormat_Text:
+      write_labelled(table, out, labels, true, " | ");
+      break;
+
+    case GrpTblFormat_CSV:
+      write_labelled(table, out, labels, false, ",");
+      break;
+
+    case GrpTblFormat_Index:
+      out.put("elements ");
+      out.put_decimal(size);
+      out.put('\n');
+      for (uint32_t idx = 0; idx < size; idx++)
+        {
+          out.put_decimal(idx);
+          out.put(' ');
+          out.put(labels[idx]);
+          out.put('\n');
+        }
+      for (uint32_t row = 0; row < size; row++)
+        {
+          const uint32_t *products = table.get_row(row);
+
+          for (uint32_t column = 0; column < size; column++)
+            {
+              if (column > 0)
+                {
+                  out.put(' ');
+                }
+              out.put_decimal(products[column]);
+            }
+          out.put('\n');
+        }
+      break;
+
+    default:
+      return GrpErr_UnimplimentedFunction;
+    }
+
+  out.flush();
+  return out.ok() ? GrpErr_OK : GrpErr_FileAccess;
+}
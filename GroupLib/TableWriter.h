@@ -0,0 +1,59 @@
+/******************************************************************************/
+/*                                                                            */
+/*  TableWriter.h Writing Cayley tables in bulk                               */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef TABLE_WRITER_H__
+#define TABLE_WRITER_H__
+
+#include <stdint.h>
+
+#include "GroupError.h"
+#include "Group.h"
+#include "CayleyTable.h"
+
+// The ways a Cayley table can be written out
+typedef enum
+  {
+    GrpTblFormat_Text,    // Padded labels between " | ", as CreateGroupTable always printed
+    GrpTblFormat_Index,   // "elements <n>", n lines "<index> <label>", then rows of indices
+    GrpTblFormat_CSV,     // A header of labels, then each row's label and products
+    GrpTblFormat_Binary,  // See below
+    GrpTblFormat_MaxFormat
+  } GrpTblFormat_t;
+
+// The binary layout, integers in host byte order:
+//   char     magic[8]                 "CAYLEYT1"
+//   uint32_t size, order
+//   char     values[size * order]     the elements as digit strings
+//   uint32_t products[size * size]    row by row
+extern const char binary_table_magic[8];
+
+// Writes the table built for G to the file descriptor.  The text is built
+// in a large buffer and handed to write(2) a block at a time.  Labels are
+// the element values, or their cycles when cycles is set.
+GrpErr_t write_cayley_table(Group &G, const CayleyTable &table, int fd,
+                            GrpTblFormat_t format, bool cycles);
+
+#endif // TABLE_WRITER_H__
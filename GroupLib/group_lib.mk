@@ -5,4 +5,21 @@ SRC_INCDIRS = .
 
 SOURCES := GroupElement.cpp \
   Group.cpp \
-  GroupError.cpp
+  GroupError.cpp \
+  QuotientGroup.cpp \
+  OrderProfile.cpp \
+  GroupStream.cpp \
+  ParallelStream.cpp \
+  CayleyTable.cpp \
+  ElementArena.cpp \
+  PolygonElement.cpp \
+  ElementBatch.cpp \
+  ElementAction.cpp \
+  SparsePermutation.cpp \
+  CycleNotation.cpp \
+  TableWriter.cpp \
+  CayleyGraph.cpp \
+  Factorization.cpp \
+  RandomElements.cpp \
+  GroupAction.cpp \
+  GroupCache.cpp
@@ -25,7 +25,11 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <string>
+
 #include <GroupElement.h>
+#include <CycleNotation.h>
 
 GroupElement identity;
 GroupElement a_element;
@@ -50,14 +54,16 @@ void
 usage(char * cmd)
 {
   std::cout << cmd << "-a <element> -b <element> -d\n";
-  std::cout << "       -a <element> where element is a string of numbers\n";
-  std::cout << "       -b <element> where element is a string of numbers\n";
+  std::cout << "       -a <element> where element is a string of numbers or cycles\n";
+  std::cout << "       -b <element> where element is a string of numbers or cycles\n";
   std::cout << "       -d           Print debugging information\n";
   std::cout << "NOTE: <element> must contain a number corresponding to each index\n";
   std::cout << "      where the index starts with 0\n";
   std::cout << "      The numbers need (should) not be consecuting eg. 4651230\n";
   std::cout << "NOTE: The order for b must be equal to the order of a\n";
   std::cout << "      I.e. if a has 6 numbers then b must also\n";
+  std::cout << "NOTE: Cycles such as \"(0 3)(1 2 4)\" take the order of the other\n";
+  std::cout << "      element, or the least order they fit when both are cycles\n";
 
 }
 
@@ -86,7 +92,11 @@ main(int32_t argc, char *argv[])
         case 'a':
           a = argv[1];
           //A = argv[1];
-          if (group_order == 0)
+          if (a.find('(') != std::string::npos)
+            {
+              // Sized once both elements are known
+            }
+          else if (group_order == 0)
             {
               group_order = a.size();
             }
@@ -103,7 +113,10 @@ main(int32_t argc, char *argv[])
         case 'b':
           b = argv[1];
           //B = argv[1];
-          if (group_order == 0)
+          if (b.find('(') != std::string::npos)
+            {
+            }
+          else if (group_order == 0)
             {
               group_order = b.size();
             }
@@ -128,6 +141,32 @@ main(int32_t argc, char *argv[])
         }
     }
 
+  // Turn any cycles into numbers of the same order
+  if (group_order == 0)
+    {
+      group_order = std::max(cycle_text_order(a.data(), a.size()),
+                             cycle_text_order(b.data(), b.size()));
+    }
+  for (std::string *text : { &a, &b })
+    {
+      GroupElement parsed;
+
+      if (text->find('(') == std::string::npos)
+        {
+          continue;
+        }
+
+      GrpErr_t error = parse_element_text(*text, group_order, parsed);
+
+      if (error != GrpErr_OK)
+        {
+          std::cerr << "ERROR: Cannot read the cycles " << *text << " <"
+                    << error << "> " << get_error_msg(error) << "\n";
+          return 0;
+        }
+      *text = parsed.get_element();
+    }
+
   // Do some quick checks on the input
 
   if (a.size() != b.size())
@@ -190,6 +229,8 @@ main(int32_t argc, char *argv[])
   std::cout << "A <" << a_element << ">";
   std::cout << "; ";
   std::cout << "B <" << b_element << ">\n";
+  std::cout << "cycles: A " << cycle_notation(a_element)
+            << "; B " << cycle_notation(b_element) << "\n";
   if (debug) print_elements();
 
   std::cout << " 1: Does the assignment work? C <- I ----------------------------------- ";
@@ -369,4 +410,41 @@ main(int32_t argc, char *argv[])
     {
       std::cout << "PASS <" << e.get_error_code() << ": " << e.get_error_msg() << ">\n";
     }
+
+  std::string a_cycles = cycle_notation(a_element);
+
+  std::cout << "12: Does A read back from its cycles? C <- " << a_cycles
+            << std::string(a_cycles.size() < 29 ? 29 - a_cycles.size() : 1, '-') << " ";
+  if (parse_element_text(a_cycles, group_order, c_element) == GrpErr_OK
+      && c_element == a_element)
+    {
+      std::cout << "PASS\n";
+    }
+  else
+    {
+      std::cout << "FAIL\n";
+    }
+
+  std::cout << "13: Do the error codes match the exceptions? A(-1) * A, <" << bad_element
+            << ">" << std::string(bad_element.size() < 14 ? 14 - bad_element.size() : 1, '-')
+            << " ";
+
+  GroupElement unset;
+  std::string inverse_value;
+  bool equal;
+  bool odd;
+  bool pass = (a_element.try_get_inverse(inverse_value) == GrpErr_OK)
+              && (c_element.try_set_element(inverse_value) == GrpErr_OK)
+              && (c_element.try_multiply(a_element) == GrpErr_OK)
+              && (c_element.try_equals(identity, equal) == GrpErr_OK) && equal
+              && (c_element.try_is_odd(odd) == GrpErr_OK) && !odd
+              && (c_element.try_set_element(bad_element) == GrpErr_ElementValueDuplicated)
+              && (a_element.try_equals(unset, equal) == GrpErr_IncompatibleGroupElement)
+              && (a_element.try_multiply(unset) == GrpErr_IncompatibleGroupElement)
+              && (unset.try_is_odd(odd) == GrpErr_UninitializedElement)
+              && (unset.try_get_inverse(inverse_value) == GrpErr_UndefinedGroupOrder)
+              && (unset.try_set_element(std::string(max_order + 1, '0'))
+                  == GrpErr_ElementOverflow);
+
+  std::cout << (pass ? "PASS\n" : "FAIL\n");
 }
@@ -0,0 +1,210 @@
+/******************************************************************************/
+/*                                                                            */
+/*  BatchMultiply.cpp: Checks and times multiplying packed element values     */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <ElementBatch.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " [<order>]\n";
+  std::cout << "       Checks the batched products for every order, then reports the products\n";
+  std::cout << "       per second over Sn for the given order [4-10] (default 9)\n";
+}
+
+static std::string
+random_value(uint32_t order, std::mt19937 &rng)
+{
+  std::string value;
+
+  for (uint32_t i = 0; i < order; i++)
+    {
+      value += i + '0';
+    }
+  std::shuffle(value.begin(), value.end(), rng);
+  return value;
+}
+
+// Every order, awkward counts so the tails are used, a separate output
+// and the values overwritten in place, and the scalar loop on its own
+static bool
+check_batches(GrpElDirection_t side)
+{
+  std::mt19937 rng(2020);
+
+  for (uint32_t order = 1; order <= max_order; order++)
+    {
+      for (uint32_t count = 0; count < 40; count += 7)
+        {
+          std::string fixed = random_value(order, rng);
+          std::string values;
+          std::string expected;
+          std::string product;
+
+          for (uint32_t k = 0; k < count; k++)
+            {
+              std::string value = random_value(order, rng);
+
+              values += value;
+              if (side == GrpElDirection_left)
+                {
+                  multiply_element_values(fixed, value, product);
+                }
+              else
+                {
+                  multiply_element_values(value, fixed, product);
+                }
+              expected += product;
+            }
+
+          std::string products(values.size(), ' ');
+          std::string in_place = values;
+          std::string scalar(values.size(), ' ');
+
+          multiply_packed_values(values.data(), count, order, fixed, side,
+                                 &products[0]);
+          multiply_packed_values(in_place.data(), count, order, fixed, side,
+                                 &in_place[0]);
+          multiply_packed_values_scalar(values.data(), count, order, fixed,
+                                        side, &scalar[0]);
+          if (products != expected || in_place != expected
+              || scalar != expected)
+            {
+              return false;
+            }
+        }
+    }
+  return true;
+}
+
+static void
+throughput(const char *name, uint64_t products, double seconds)
+{
+  std::cout << "    " << name << std::string(36 - std::string(name).size(), ' ')
+            << products / seconds / 1e6 << " million products/s\n";
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t order = 9;
+
+  if (argc > 1)
+    {
+      order = atoi(argv[1]);
+    }
+  if (order < 4 || order > 10)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      std::cout << " 1: Do left batches match one product at a time? -------------------- ";
+      report(check_batches(GrpElDirection_left));
+      std::cout << " 2: Do right batches match one product at a time? ------------------- ";
+      report(check_batches(GrpElDirection_right));
+
+      Group Sn;
+      GroupElement fixed;
+      struct timespec start;
+
+      Sn.generate_Sn(order);
+
+      uint32_t count = Sn.size();
+      const char *values = Sn.get_packed_values();
+      std::vector<char> products(static_cast<size_t>(count) * order);
+      std::string product;
+
+      Sn.get_element(count / 3, fixed);
+      std::cout << "Multiplying all of S" << order << " (" << count
+                << " elements) by " << fixed << ":\n";
+
+      // The same work as the batches, one validated product at a time
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (uint32_t k = 0; k < count; k++)
+        {
+          GroupElement element;
+
+          Sn.get_element(k, element);
+          element = fixed * element;
+        }
+      throughput("GroupElement operator *", count, seconds_since(start));
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (uint32_t k = 0; k < count; k++)
+        {
+          multiply_element_values(fixed.get_element(),
+                                  std::string(values + static_cast<size_t>(k) * order, order),
+                                  product);
+        }
+      throughput("multiply_element_values", count, seconds_since(start));
+
+      for (GrpElDirection_t side : { GrpElDirection_left, GrpElDirection_right })
+        {
+          const char *name = (side == GrpElDirection_left) ? "left" : "right";
+          const uint32_t rounds = 20;
+
+          clock_gettime(CLOCK_MONOTONIC, &start);
+          for (uint32_t round = 0; round < rounds; round++)
+            {
+              multiply_packed_values_scalar(values, count, order, fixed.get_element(),
+                                            side, products.data());
+            }
+          throughput((std::string("scalar batch, ") + name).c_str(),
+                     static_cast<uint64_t>(count) * rounds, seconds_since(start));
+
+          clock_gettime(CLOCK_MONOTONIC, &start);
+          for (uint32_t round = 0; round < rounds; round++)
+            {
+              multiply_packed_values(values, count, order, fixed.get_element(),
+                                     side, products.data());
+            }
+          throughput((std::string("multiply_packed_values, ") + name).c_str(),
+                     static_cast<uint64_t>(count) * rounds, seconds_since(start));
+        }
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,154 @@
+/******************************************************************************/
+/*                                                                            */
+/*  BlockSystems.cpp: Transitivity, blocks and primitivity                    */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <time.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <CycleNotation.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << "\n";
+  std::cout << "       Checks transitivity, block systems and primitivity, then times\n";
+  std::cout << "       is_primitive on S16 given by two generators\n";
+}
+
+// The group given by the generators alone, without its elements
+static Group
+generated_by(const std::string &first, const std::string &second, uint32_t order)
+{
+  std::vector<GroupElement> generators;
+  Group G;
+
+  generators.push_back(cycles_element(first, order));
+  if (second != "")
+    {
+      generators.push_back(cycles_element(second, order));
+    }
+  G.set_generators(generators);
+  return G;
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  if (argc > 1)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      Group C6;
+      Group D6;
+      Group S5;
+      Group A4;
+      Group intransitive = generated_by("(0 1 2)(3 4)", "", 6);
+
+      C6.generate_Cn(6);
+      D6.generate_Dn(6);
+      S5.generate_Sn(5);
+      A4.generate_An(4);
+
+      bool pass = C6.is_transitive() && D6.is_transitive() && S5.is_transitive()
+                  && A4.is_transitive() && !intransitive.is_transitive();
+      std::cout << " 1: Are Cn, Dn, Sn and An transitive and <(0 1 2)(3 4)> not? -------- ";
+      report(pass);
+
+      // The opposite vertices of a hexagon are the smallest blocks of D6;
+      // the alternate ones are blocks too
+      std::vector<uint32_t> block_ids;
+      std::vector<uint32_t> opposite = {0, 1, 2, 0, 1, 2};
+      std::vector<uint32_t> alternate = {0, 1, 0, 1, 0, 1};
+
+      pass = (D6.minimal_block_system(block_ids) == GrpErr_OK) && (block_ids == opposite)
+             && (D6.minimal_blocks(0, 2, block_ids) == GrpErr_OK) && (block_ids == alternate)
+             && (D6.minimal_blocks(0, 1, block_ids) == GrpErr_OK)
+             && (block_ids == std::vector<uint32_t>(6, 0));
+      std::cout << " 2: Are the block systems of D6 its opposite and alternate points? -- ";
+      report(pass);
+
+      // S2 wr S3 keeps {0,1}, {2,3} and {4,5} together
+      Group wreath = generated_by("(0 1)", "(0 2 4)(1 3 5)", 6);
+      Group C7;
+      Group D5;
+
+      C7.generate_Cn(7);
+      D5.generate_Dn(5);
+      pass = S5.is_primitive() && A4.is_primitive() && C7.is_primitive()
+             && D5.is_primitive() && !C6.is_primitive() && !D6.is_primitive()
+             && !intransitive.is_primitive() && !wreath.is_primitive()
+             && (wreath.minimal_block_system(block_ids) == GrpErr_OK)
+             && (block_ids == std::vector<uint32_t>({0, 0, 1, 1, 2, 2}));
+      std::cout << " 3: Are the primitive groups told from the imprimitive ones? -------- ";
+      report(pass);
+
+      // Degree 16 from generators alone
+      Group S16 = generated_by("(0 1)", "(0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)", 16);
+      Group C16 = generated_by("(0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)", "", 16);
+
+      pass = S16.is_primitive() && !C16.is_primitive()
+             && (C16.minimal_block_system(block_ids) == GrpErr_OK)
+             && (block_ids[3] == block_ids[11]) && (block_ids[3] != block_ids[4])
+             && (intransitive.minimal_block_system(block_ids) == GrpErr_NotTransitive)
+             && (S16.minimal_blocks(0, 16, block_ids) == GrpErr_IndexOutOfBounds);
+      std::cout << " 4: Do generators alone settle degree 16 and bad requests fail? ----- ";
+      report(pass);
+
+      const uint32_t tests = 100000;
+      uint32_t primitive = 0;
+      struct timespec start;
+      struct timespec now;
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (uint32_t idx = 0; idx < tests; idx++)
+        {
+          primitive += S16.is_primitive();
+        }
+      clock_gettime(CLOCK_MONOTONIC, &now);
+
+      double seconds = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+
+      std::cout << tests << " primitivity tests of S16: " << seconds / tests * 1e6
+                << " us each" << (primitive == tests ? "" : ", WRONG") << "\n";
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
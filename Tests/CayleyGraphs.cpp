@@ -0,0 +1,218 @@
+/******************************************************************************/
+/*                                                                            */
+/*  CayleyGraphs.cpp: Word lengths by breadth first search                    */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <CycleNotation.h>
+#include <CayleyGraph.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " [<n> [<threads>]]\n";
+  std::cout << "       Checks word lengths on small groups, then times the search of\n";
+  std::cout << "       Sn generated by adjacent transpositions (default n = 9)\n";
+}
+
+// (0 1), (1 2), ..., (n-2 n-1)
+static std::vector<GroupElement>
+adjacent_transpositions(uint32_t order)
+{
+  std::vector<GroupElement> generators;
+
+  for (uint32_t i = 0; i + 1 < order; i++)
+    {
+      generators.push_back(cycles_element("(" + std::to_string(i) + " "
+                                          + std::to_string(i + 1) + ")", order));
+    }
+  return generators;
+}
+
+static uint32_t
+inversions(const std::string &value)
+{
+  uint32_t count = 0;
+
+  for (uint32_t i = 0; i < value.size(); i++)
+    {
+      for (uint32_t j = i + 1; j < value.size(); j++)
+        {
+          count += (value[i] > value[j]);
+        }
+    }
+  return count;
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t order = 9;
+  uint32_t threads = 0;
+
+  if (argc > 1)
+    {
+      order = atoi(argv[1]);
+    }
+  if (argc > 2)
+    {
+      threads = atoi(argv[2]);
+    }
+  if (order < 2 || order > max_graph_order)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      // The word length in adjacent transpositions is the inversion count
+      CayleyGraph graph;
+      bool pass = (graph.generate_Sn(5, adjacent_transpositions(5)) == GrpErr_OK)
+                  && (graph.word_lengths() == GrpErr_OK);
+      const uint64_t mahonian[] = {1, 4, 9, 15, 20, 22, 20, 15, 9, 4, 1};
+
+      pass = pass && (graph.diameter() == 10) && (graph.reached() == 120)
+             && std::equal(graph.get_level_sizes().begin(),
+                           graph.get_level_sizes().end(), mahonian);
+      for (uint64_t v = 0; v < graph.size() && pass; v++)
+        {
+          std::string value;
+
+          unrank_element_value(5, v, value);
+          pass = (graph.get_distances()[v] == inversions(value));
+        }
+      std::cout << " 1: Are S5 word lengths in adjacent transpositions the inversions? -- ";
+      report(pass);
+
+      // The same search over the element indices of a Group
+      Group S5;
+      CayleyGraph group_graph;
+      std::vector<GroupElement> generators;
+
+      generators.push_back(cycles_element("(0 1)", 5));
+      generators.push_back(cycles_element("(0 1 2 3 4)", 5));
+      S5.generate_Sn(5);
+      pass = (graph.generate_Sn(5, generators) == GrpErr_OK)
+             && (graph.word_lengths() == GrpErr_OK)
+             && (group_graph.generate(S5, generators) == GrpErr_OK)
+             && (group_graph.word_lengths() == GrpErr_OK)
+             && (group_graph.get_level_sizes() == graph.get_level_sizes());
+      for (uint32_t idx = 0; idx < S5.size() && pass; idx++)
+        {
+          GroupElement e;
+
+          S5.get_element(idx, e);
+          pass = (group_graph.get_distances()[idx]
+                  == graph.get_distances()[e.get_rank()]);
+        }
+      std::cout << " 2: Do Group indices and Sn ranks give the same distances? ---------- ";
+      report(pass);
+
+      // A rotation walks Cn one element per level
+      Group C7;
+
+      C7.generate_Cn(7);
+      generators.assign(1, cycles_element("(0 1 2 3 4 5 6)", 7));
+      pass = (group_graph.generate(C7, generators) == GrpErr_OK)
+             && (group_graph.word_lengths() == GrpErr_OK)
+             && (group_graph.diameter() == 6)
+             && (group_graph.get_level_sizes() == std::vector<uint64_t>(7, 1));
+      std::cout << " 3: Is the diameter of C7 over one rotation 6? ---------------------- ";
+      report(pass);
+
+      // A set that does not generate leaves vertices unreached
+      generators.assign(1, cycles_element("(0 1)(2 3)", 4));
+      pass = (graph.generate_Sn(4, generators) == GrpErr_OK)
+             && (graph.word_lengths(2) == GrpErr_OK)
+             && (graph.reached() == 2) && (graph.diameter() == 1)
+             && (std::count(graph.get_distances().begin(), graph.get_distances().end(),
+                            unreached_vertex) == 22);
+      std::cout << " 4: Are vertices outside the generated subgroup unreached? ---------- ";
+      report(pass);
+
+      Group A4;
+
+      A4.generate_An(4);
+      generators.assign(1, cycles_element("(0 1)", 4));
+      pass = (group_graph.generate(A4, generators) == GrpErr_IncompatibleGroupElement)
+             && (graph.generate_Sn(5, generators) == GrpErr_OrderMismatch)
+             && (graph.generate_Sn(max_graph_order + 1, generators) == GrpErr_ElementOverflow);
+      std::cout << " 5: Are generators outside the group refused? ----------------------- ";
+      report(pass);
+
+      // Splitting the levels over workers changes nothing
+      CayleyGraph serial;
+
+      generators.clear();
+      generators.push_back(cycles_element("(0 1)", 7));
+      generators.push_back(cycles_element("(0 1 2 3 4 5 6)", 7));
+      pass = (serial.generate_Sn(7, generators) == GrpErr_OK)
+             && (serial.word_lengths(1) == GrpErr_OK)
+             && (graph.generate_Sn(7, generators) == GrpErr_OK)
+             && (graph.word_lengths(4) == GrpErr_OK)
+             && (graph.reached() == 5040)
+             && (graph.get_distances() == serial.get_distances());
+      std::cout << " 6: Do one and four workers find the same S7 word lengths? ---------- ";
+      report(pass);
+
+      struct timespec start;
+      struct timespec now;
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      graph.generate_Sn(order, adjacent_transpositions(order));
+      graph.word_lengths(threads);
+      clock_gettime(CLOCK_MONOTONIC, &now);
+
+      double seconds = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+
+      std::cout << "S" << order << " by adjacent transpositions: " << graph.reached()
+                << " elements, diameter " << graph.diameter() << " in " << seconds
+                << " s (" << graph.reached() / seconds / 1e6 << " million/s)\n";
+      std::cout << "Level sizes:";
+      for (uint32_t d = 0; d < graph.get_level_sizes().size(); d++)
+        {
+          std::cout << " " << graph.get_level_sizes()[d];
+        }
+      std::cout << "\n";
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
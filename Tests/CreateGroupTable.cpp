@@ -26,23 +26,40 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <fcntl.h>
 #include <getopt.h>
+#include <unistd.h>
 
+#include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <GroupElement.h>
 #include <Group.h>
+#include <CayleyTable.h>
+#include <CycleNotation.h>
+#include <TableWriter.h>
 
 void
 usage(char *cmd)
 {
   std::cerr << "USAGE: " << cmd << " [OPTIONS]\n";
   std::cerr << "       -a, --alternating <order>       -- Generate the Alternating group An (Even subgroup of Sn).\n";
-  std::cerr << "       -c, --cyclic 012[3[4...]]]      -- Generate the group from cycling on the given element.\n";
+  std::cerr << "       -c, --cyclic <element>          -- Generate the group from cycling on the given element,\n";
+  std::cerr << "                                          as digits 012[3[4...]]] or cycles such as \"(0 2)(1 3)\".\n";
+  std::cerr << "       -n, --degree <order>            -- The order of a --cyclic element given as cycles.\n";
   std::cerr << "       -d, --dihedral <vertices>       -- Generate dihedral group for a polygon Dn (rotations and reflections).\n";
-  std::cerr << "       -f, --file <filename>           -- Read the group from the given file\n";
+  std::cerr << "       -f, --file <filename>           -- Generate the group from the elements listed in the file.\n";
   std::cerr << "       -r, --rotation <vertices>       -- Generate polygonal rotation.\n";
   std::cerr << "       -s, --permutation <group_order> -- Generate the symmetric group Sn.\n";
+  std::cerr << "       -k, --checkpoint <filename>     -- Append the finished table rows here as they are built.\n";
+  std::cerr << "       -i, --interval <seconds>        -- Seconds between checkpoints (default 60).\n";
+  std::cerr << "       -R, --resume                    -- Continue from the rows saved in the checkpoint,\n";
+  std::cerr << "                                          or start from the first row when there is none yet.\n";
+  std::cerr << "       -C, --cycles                    -- Print the table in cycle notation.\n";
+  std::cerr << "       -F, --format <format>           -- text (default), index, csv or binary.\n";
+  std::cerr << "       -o, --output <filename>         -- Write the table to the file instead of stdout.\n";
 }
 
 int32_t
@@ -51,11 +68,19 @@ main(int32_t argc, char *argv[])
   try
     {
       std::string group_seed = "";
+      std::string group_file = "";
+      uint32_t seed_order = 0;
+      bool cycles = false;
       Group group1;
       GroupElement element1;
       int32_t opt;
       GrpGen_t gen_type = GrpGen_Unknown;
       uint32_t vertices = 0;
+      std::string checkpoint_file = "";
+      uint32_t checkpoint_seconds = 60;
+      bool resume = false;
+      GrpTblFormat_t format = GrpTblFormat_Text;
+      std::string output_file = "";
 
       while (1)
         {
@@ -69,13 +94,20 @@ main(int32_t argc, char *argv[])
               {"file"  ,      required_argument, 0,  'f'},
               {"rotation",    required_argument, 0,  'r'},
               {"permutation", required_argument, 0,  's'},
+              {"checkpoint",  required_argument, 0,  'k'},
+              {"interval",    required_argument, 0,  'i'},
+              {"resume",      no_argument,       0,  'R'},
+              {"degree",      required_argument, 0,  'n'},
+              {"cycles",      no_argument,       0,  'C'},
+              {"format",      required_argument, 0,  'F'},
+              {"output",      required_argument, 0,  'o'},
               {"Help",        no_argument,       0,  'H'},
               {"help",        no_argument,       0,  'h'},
               {"HELP",        no_argument,       0,  '?'},
               {0,             0,                 0,   0 }
             };
 
-          opt = getopt_long(argc, argv, "a:c:d:f:r:s:hH?",
+          opt = getopt_long(argc, argv, "a:c:d:f:r:s:k:i:Rn:CF:o:hH?",
                             long_options, &option_index);
           if (opt == -1)
             {
@@ -94,14 +126,13 @@ main(int32_t argc, char *argv[])
               break;
 
             case 'd': // Rotations and Reflections
-              std::cout << "Currently the focus\n";
               gen_type = GrpGen_Dn;
               vertices = atoi(optarg);
               break;
 
             case 'f':
-              std::cout << "Currently unavailable\n";
-              return 0;
+              gen_type = GrpGen_FromFile;
+              group_file = optarg;
               break;
 
             case 'r':  // Rotations
@@ -114,6 +145,55 @@ main(int32_t argc, char *argv[])
               vertices = atoi(optarg);
               break;
 
+            case 'k':
+              checkpoint_file = optarg;
+              break;
+
+            case 'i':
+              checkpoint_seconds = atoi(optarg);
+              break;
+
+            case 'R':
+              resume = true;
+              break;
+
+            case 'n':
+              seed_order = atoi(optarg);
+              break;
+
+            case 'C':
+              cycles = true;
+              break;
+
+            case 'F':
+              if (strcmp(optarg, "text") == 0)
+                {
+                  format = GrpTblFormat_Text;
+                }
+              else if (strcmp(optarg, "index") == 0)
+                {
+                  format = GrpTblFormat_Index;
+                }
+              else if (strcmp(optarg, "csv") == 0)
+                {
+                  format = GrpTblFormat_CSV;
+                }
+              else if (strcmp(optarg, "binary") == 0)
+                {
+                  format = GrpTblFormat_Binary;
+                }
+              else
+                {
+                  std::cerr << "Error: Unknown table format " << optarg << "\n";
+                  usage(argv[0]);
+                  return 0;
+                }
+              break;
+
+            case 'o':
+              output_file = optarg;
+              break;
+
             default:
               std::cerr << "Error: Unknown command line argument [" << opt << "]\n";
               // no break; just fall into the help
@@ -132,16 +212,31 @@ main(int32_t argc, char *argv[])
           // Generate the group from the seed provided
           if (group_seed != "")
             {
-              element1.set_element(group_seed);
+              GrpErr_t seed_error = parse_element_text(group_seed, seed_order,
+                                                       element1);
 
+              if (seed_error != GrpErr_OK)
+                {
+                  std::cerr << "Error reading the element " << group_seed << " "
+                            << seed_error << ": " << get_error_msg(seed_error) << "\n";
+                  return 0;
+                }
               group1.generate(element1);
-              std::cout << "Cyclic G: " << group1 << "\n";
+              // Only the text table has room for a heading
+              if (format == GrpTblFormat_Text)
+                {
+                  std::cout << "Cyclic G: " << group1 << "\n";
+                }
             }
           break;
         case GrpGen_Sn:
           group1.generate_Sn(vertices);
           break;
         case GrpGen_Dn:
+          if (format == GrpTblFormat_Text)
+            {
+              std::cout << "Currently the focus\n";
+            }
           group1.generate_Dn(vertices);
           break;
         case GrpGen_Cn:
@@ -151,53 +246,66 @@ main(int32_t argc, char *argv[])
           group1.generate_An(vertices);
           break;
         case GrpGen_FromFile:
-          std::cerr << "Unavailable generator type: " << gen_type << "\n";
+          {
+            std::ifstream in(group_file.c_str());
+            GrpErr_t file_error = in ? group1.generate_group_from_file(in)
+                                     : GrpErr_FileAccess;
+
+            if (file_error != GrpErr_OK)
+              {
+                std::cerr << "Error reading " << group_file << " "
+                          << file_error << ": " << get_error_msg(file_error) << "\n";
+                return 0;
+              }
+          }
           break;
         default:
           std::cerr << "Unknown generator type: " << gen_type << "\n";
           break;
         }
 
-      // Move the elements into a vector for easier manipulation
-      uint32_t group_size = group1.size();
-      std::vector<GroupElement> e_list;
+      if (resume && (checkpoint_file.empty()
+                     || !std::ifstream(checkpoint_file.c_str())))
+        {
+          std::cerr << "Note: no checkpoint to resume from, starting from the first row\n";
+        }
+
+      CayleyTable table;
+      GrpErr_t table_error = table.generate(group1, checkpoint_file,
+                                            checkpoint_seconds, resume);
 
-      for (uint32_t idx = 0; idx < group_size; idx++)
+      if (table_error != GrpErr_OK)
         {
-          GroupElement e;
+          std::cerr << "Error building the table " << table_error
+                    << ": " << get_error_msg(table_error) << "\n";
+          return 0;
+        }
 
-          if (!group1.get_element(idx, e))
-            {
-              std::cerr << "Error: Cannot get the element at position " << idx << "\n";
-            }
-          else
+      // Anything already printed goes out ahead of the table
+      std::cout.flush();
+
+      int fd = STDOUT_FILENO;
+
+      if (output_file != "")
+        {
+          fd = open(output_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+          if (fd < 0)
             {
-              e_list.push_back(e);
+              std::cerr << "Error: Cannot open " << output_file << "\n";
+              return 0;
             }
         }
 
-      // print out the header
-      for (uint32_t idx2 = 0; idx2 < e_list[0].get_order(); idx2++)
-        {
-          std::cout << " ";
-        }
+      GrpErr_t write_error = write_cayley_table(group1, table, fd, format, cycles);
 
-      for (uint32_t idx1 = 0; idx1 < e_list.size(); idx1++)
+      if (fd != STDOUT_FILENO && close(fd) != 0 && write_error == GrpErr_OK)
         {
-          std::cout << " | " << e_list[idx1].get_element();
+          write_error = GrpErr_FileAccess;
         }
-      std::cout << "\n";
-
-      for (uint32_t idx1 = 0; idx1 < e_list.size(); idx1++)
+      if (write_error != GrpErr_OK)
         {
-          std::cout << e_list[idx1].get_element();
-          for (uint32_t idx2 = 0; idx2 < e_list.size(); idx2++)
-            {
-              GroupElement out;
-              out = e_list[idx1] * e_list[idx2];
-              std::cout << " | " << out;
-            }
-          std::cout << "\n";
+          std::cerr << "Error writing the table " << write_error
+                    << ": " << get_error_msg(write_error) << "\n";
         }
     }
   catch (GroupError &e)
@@ -0,0 +1,231 @@
+/******************************************************************************/
+/*                                                                            */
+/*  CycleText.cpp: Checks and times the cycle notation reader and writer      */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <GroupStream.h>
+#include <CycleNotation.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " [<order>]\n";
+  std::cout << "       Checks cycle notation over all of Sn for the given order [2-10]\n";
+  std::cout << "       (default 8) and reports how fast it is read and written\n";
+}
+
+static bool
+reads_as(const char *text, uint32_t order, const char *expected)
+{
+  char value[max_order];
+
+  return parse_cycle_value(text, strlen(text), order, value) == GrpErr_OK
+    && std::string(value, order) == expected;
+}
+
+static bool
+refused(const char *text, uint32_t order, GrpErr_t expected)
+{
+  char value[max_order];
+
+  return parse_cycle_value(text, strlen(text), order, value) == expected;
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t order = 8;
+
+  if (argc > 1)
+    {
+      order = atoi(argv[1]);
+    }
+  if (order < 2 || order > 10)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      std::vector<std::string> values;
+      bool pass = true;
+
+      for_each_Sn(order, [&](const std::string &value) -> bool
+        {
+          values.push_back(value);
+          return true;
+        });
+
+      for (size_t idx = 0; idx < values.size() && pass; idx++)
+        {
+          char text[max_cycle_text];
+          char value[max_order];
+          size_t length = format_cycle_value(values[idx].data(), order, text);
+
+          pass = parse_cycle_value(text, length, order, value) == GrpErr_OK
+            && values[idx].compare(0, order, value, order) == 0;
+        }
+      std::cout << " 1: Does every element of S" << order
+                << " read back from its cycles? ------------- ";
+      report(pass);
+
+      std::cout << " 2: Are commas, semicolons and tabs separators? --------------------- ";
+      report(reads_as("(0 3 2)(1 4)", 5, "34021") &&
+             reads_as("(0,3,2);(1,4)", 5, "34021") &&
+             reads_as(" (0\t3 2) , (1 4) ", 5, "34021") &&
+             reads_as("()", 5, "01234") && reads_as("", 5, "01234") &&
+             reads_as("(2)", 5, "01234"));
+
+      std::cout << " 3: Are points past nine unambiguous? ------------------------------- ";
+      {
+        GroupElement e;
+        char text[max_cycle_text];
+
+        pass = reads_as("(1 10)(0 11 15)", 16, ";:234567891?<=>0");
+        e.set_order(16);
+        e.set_element(";:234567891?<=>0");
+        format_cycle_value(e.get_element().data(), 16, text);
+        report(pass && std::string(text) == "(0 11 15)(1 10)"
+               && cycle_notation(e) == text);
+      }
+
+      GroupElement digits;
+
+      std::cout << " 4: Is text that is not an element refused? ------------------------- ";
+      report(parse_element_text("0123456789:;<=>?@", 0, digits) == GrpErr_ElementOverflow &&
+             parse_element_text("0013", 0, digits) == GrpErr_ElementValueDuplicated &&
+             refused("(0 1", 5, GrpErr_ParseError) &&
+             refused("0 1)", 5, GrpErr_ParseError) &&
+             refused("((0 1))", 5, GrpErr_ParseError) &&
+             refused("(0 x)", 5, GrpErr_ParseError) &&
+             refused("(0 1)(1 2)", 5, GrpErr_ElementValueDuplicated) &&
+             refused("(0 5)", 5, GrpErr_ElementValueOutOfRange));
+
+      std::cout << " 5: Does a file of cycles generate the group? ----------------------- ";
+      {
+        Group from_file;
+        Group Sn;
+        std::stringstream file;
+
+        file << "# S" << order << " from two generators\n"
+             << "order " << order << "\n"
+             << "(0 1)\n"
+             << "(0";
+        for (uint32_t point = 1; point < order; point++)
+          {
+            file << " " << point;
+          }
+        file << ")\n";
+
+        Sn.generate_Sn(order);
+        report(from_file.generate_group_from_file(file) == GrpErr_OK
+               && from_file.size() == Sn.size());
+      }
+
+      std::cout << " 6: Is \"\" the identity and a bad order line refused? ---------------- ";
+      {
+        GroupElement empty;
+        bool pass = (parse_element_text("", 5, empty) == GrpErr_OK)
+                    && (empty.get_element() == "01234")
+                    && (parse_element_text("", 0, empty) == GrpErr_UndefinedGroupOrder);
+
+        for (const char *order_line : {"order x", "order 5x", "order", "order 0",
+                                       "order 17", "orders 5"})
+          {
+            Group from_file;
+            std::stringstream file;
+
+            file << order_line << "\n(0 1)\n";
+            pass = pass && (from_file.generate_group_from_file(file) == GrpErr_ParseError);
+          }
+        report(pass);
+      }
+
+      // The text path against the usual stream formatting
+      struct timespec start;
+      size_t total = 0;
+      char text[max_cycle_text];
+      char value[max_order];
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (size_t idx = 0; idx < values.size(); idx++)
+        {
+          total += format_cycle_value(values[idx].data(), order, text);
+        }
+
+      double format_seconds = seconds_since(start);
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (size_t idx = 0; idx < values.size(); idx++)
+        {
+          size_t length = format_cycle_value(values[idx].data(), order, text);
+
+          parse_cycle_value(text, length, order, value);
+        }
+
+      double round_trip_seconds = seconds_since(start);
+      std::ostringstream stream;
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (size_t idx = 0; idx < values.size(); idx++)
+        {
+          GroupElement element;
+
+          element.set_element(values[idx]);
+          stream.str("");
+          stream << element;
+        }
+
+      double stream_seconds = seconds_since(start);
+
+      std::cout << values.size() << " elements, " << total << " characters of cycles\n";
+      std::cout << "    format_cycle_value        "
+                << values.size() / format_seconds / 1e6 << " million/s\n";
+      std::cout << "    format and parse          "
+                << values.size() / round_trip_seconds / 1e6 << " million/s\n";
+      std::cout << "    set_element and stream    "
+                << values.size() / stream_seconds / 1e6 << " million/s\n";
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
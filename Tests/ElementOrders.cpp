@@ -0,0 +1,204 @@
+/******************************************************************************/
+/*                                                                            */
+/*  ElementOrders.cpp: Element order histogram and cyclic subgroups           */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <getopt.h>
+
+#include <iostream>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <OrderProfile.h>
+#include <GroupStream.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cerr << "USAGE: " << cmd << " [OPTIONS]\n";
+  std::cerr << "       -a, --alternating <order>       -- Profile the Alternating group An.\n";
+  std::cerr << "       -d, --dihedral <vertices>       -- Profile the dihedral group Dn.\n";
+  std::cerr << "       -r, --rotation <vertices>       -- Profile the polygonal rotations Cn.\n";
+  std::cerr << "       -s, --permutation <group_order> -- Profile the symmetric group Sn.\n";
+  std::cerr << "       -t, --threads <count>           -- Worker threads (default one per core).\n";
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  try
+    {
+      Group group1;
+      GrpGen_t gen_type = GrpGen_Unknown;
+      uint32_t vertices = 0;
+      uint32_t threads = 0;
+      int32_t opt;
+
+      while (1)
+        {
+          int32_t option_index = 0;
+
+          static struct option long_options[] =
+            {
+              {"alternating", required_argument, 0,  'a'},
+              {"dihedral",    required_argument, 0,  'd'},
+              {"rotation",    required_argument, 0,  'r'},
+              {"permutation", required_argument, 0,  's'},
+              {"threads",     required_argument, 0,  't'},
+              {"help",        no_argument,       0,  'h'},
+              {0,             0,                 0,   0 }
+            };
+
+          opt = getopt_long(argc, argv, "a:d:r:s:t:h",
+                            long_options, &option_index);
+          if (opt == -1)
+            {
+              break;
+            }
+          switch (opt)
+            {
+            case 'a':
+              gen_type = GrpGen_An;
+              vertices = atoi(optarg);
+              break;
+            case 'd':
+              gen_type = GrpGen_Dn;
+              vertices = atoi(optarg);
+              break;
+            case 'r':
+              gen_type = GrpGen_Cn;
+              vertices = atoi(optarg);
+              break;
+            case 's':
+              gen_type = GrpGen_Sn;
+              vertices = atoi(optarg);
+              break;
+            case 't':
+              threads = atoi(optarg);
+              break;
+            default:
+              usage(argv[0]);
+              return 0;
+            }
+        }
+
+      switch (gen_type)
+        {
+        case GrpGen_Sn:
+          group1.generate_Sn(vertices);
+          break;
+        case GrpGen_An:
+          group1.generate_An(vertices);
+          break;
+        case GrpGen_Dn:
+          group1.generate_Dn(vertices);
+          break;
+        case GrpGen_Cn:
+          group1.generate_Cn(vertices);
+          break;
+        default:
+          usage(argv[0]);
+          return 0;
+        }
+
+      OrderProfile profile;
+      OrderProfile single;
+
+      profile.generate(group1, threads);
+      std::cout << "|G| = " << group1.size() << "\n" << profile;
+
+      // Every element of order k generates a cyclic subgroup with phi(k)
+      // generators, and the counts may not depend on the worker count
+      const std::map<uint32_t, uint64_t> &histogram = profile.get_order_histogram();
+      std::map<uint32_t, uint64_t>::const_iterator itr;
+      uint64_t total = 0;
+      bool consistent = true;
+
+      for (itr = histogram.begin(); itr != histogram.end(); ++itr)
+        {
+          total += itr->second;
+          consistent &= (profile.count_cyclic_subgroups(itr->first)
+                         * euler_phi(itr->first) == itr->second);
+        }
+
+      std::cout << " 1: Do the order counts add up to |G|? ----------------------------- ";
+      std::cout << ((total == group1.size()) ? "PASS\n" : "FAIL\n");
+
+      std::cout << " 2: Does each cyclic subgroup appear once? ------------------------- ";
+      std::cout << (consistent ? "PASS\n" : "FAIL\n");
+
+      std::cout << " 3: Does a single worker give the same profile? -------------------- ";
+      single.generate(group1, 1);
+      std::cout << ((single.get_order_histogram() == histogram
+                     && single.get_cyclic_subgroups() == profile.get_cyclic_subgroups())
+                    ? "PASS\n" : "FAIL\n");
+
+      std::cout << " 4: Does the element stream visit exactly G? ----------------------- ";
+      uint64_t visited = 0;
+      uint64_t found = 0;
+      GrpVisitor_t count = [&](const std::string &element_value)
+        {
+          GroupElement e;
+
+          e.set_element(element_value);
+          visited++;
+          found += group1.contains(e);
+          return true;
+        };
+      switch (gen_type)
+        {
+        case GrpGen_Sn:
+          for_each_Sn(vertices, count);
+          break;
+        case GrpGen_An:
+          for_each_An(vertices, count);
+          break;
+        case GrpGen_Dn:
+          for_each_Dn(vertices, count);
+          break;
+        default:
+          for_each_Cn(vertices, count);
+          break;
+        }
+      std::cout << ((visited == group1.size() && found == visited)
+                    ? "PASS\n" : "FAIL\n");
+
+      std::cout << " 5: Does the stream stop when the visitor asks? -------------------- ";
+      visited = 0;
+      for_each_Sn(vertices, [&](const std::string &)
+        {
+          return ++visited < 3;
+        });
+      std::cout << ((visited == 3) ? "PASS\n" : "FAIL\n");
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << "Error: " << e.get_error_code()
+                << ": " << e.get_error_msg() << "\n";
+    }
+  return 0;
+}
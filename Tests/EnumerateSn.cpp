@@ -0,0 +1,584 @@
+/******************************************************************************/
+/*                                                                            */
+/*  EnumerateSn.cpp: Parity, order and cycle type tallies over all of Sn      */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <getopt.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+#include <GroupElement.h>
+#include <GroupStream.h>
+#include <ParallelStream.h>
+
+// Cycle types are keyed by the number of cycles of each length from 2
+// up, four bits per length.  The fixed points make up the rest.
+static uint64_t
+cycle_type_key(const std::string &element_value)
+{
+  uint32_t order = element_value.size();
+  uint32_t visited = 0;
+  uint64_t key = 0;
+
+  for (uint32_t start = 0; start < order; start++)
+    {
+      if (visited & (1u << start))
+        {
+          continue;
+        }
+
+      uint32_t length = 0;
+
+      for (uint32_t point = start; !(visited & (1u << point));
+           point = element_value[point] - '0')
+        {
+          visited |= 1u << point;
+          length++;
+        }
+      if (length > 1)
+        {
+          key += static_cast<uint64_t>(1) << (4 * (length - 2));
+        }
+    }
+  return key;
+}
+
+static uint32_t
+cycle_type_order(uint64_t key)
+{
+  uint32_t lcm = 1;
+
+  for (uint32_t length = 2; key != 0; length++, key >>= 4)
+    {
+      if (key & 0xf)
+        {
+          uint32_t a = lcm;
+          uint32_t b = length;
+
+          while (b != 0)
+            {
+              uint32_t t = a % b;
+              a = b;
+              b = t;
+            }
+          lcm = lcm / a * length;
+        }
+    }
+  return lcm;
+}
+
+static void
+print_cycle_type(uint64_t key, uint32_t order)
+{
+  uint32_t moved = 0;
+
+  for (uint32_t length = max_order; length >= 2; length--)
+    {
+      uint32_t count = (key >> (4 * (length - 2))) & 0xf;
+
+      for (uint32_t idx = 0; idx < count; idx++)
+        {
+          std::cout << "(" << length << ")";
+        }
+      moved += count * length;
+    }
+  if (moved < order)
+    {
+      std::cout << "(1)^" << (order - moved);
+    }
+}
+
+// Stops the walk at the first odd element
+class FirstOdd : public ParallelVisitor
+{
+ public:
+  ParallelVisitor *clone(void) const
+  {
+    return new FirstOdd();
+  }
+
+  bool visit(const std::string &, uint64_t, bool odd)
+  {
+    return !odd;
+  }
+
+  void merge(ParallelVisitor &)
+  {
+  }
+};
+
+class SnTally : public ParallelVisitor
+{
+ public:
+  SnTally()
+  {
+    elements = 0;
+    odd_elements = 0;
+  }
+
+  ParallelVisitor *clone(void) const
+  {
+    return new SnTally();
+  }
+
+  bool visit(const std::string &element_value, uint64_t, bool odd)
+  {
+    elements++;
+    odd_elements += odd;
+    local_classes[cycle_type_key(element_value)]++;
+    return true;
+  }
+
+  void merge(ParallelVisitor &worker)
+  {
+    SnTally &tally = static_cast<SnTally &>(worker);
+    std::unordered_map<uint64_t, uint64_t>::iterator itr;
+
+    elements += tally.elements;
+    odd_elements += tally.odd_elements;
+    for (itr = tally.local_classes.begin(); itr != tally.local_classes.end(); ++itr)
+      {
+        classes[itr->first] += itr->second;
+      }
+  }
+
+  // Element orders follow from the cycle types
+  std::map<uint32_t, uint64_t> order_histogram(void)
+  {
+    std::map<uint32_t, uint64_t> orders;
+    std::map<uint64_t, uint64_t>::iterator itr;
+
+    for (itr = classes.begin(); itr != classes.end(); ++itr)
+      {
+        orders[cycle_type_order(itr->first)] += itr->second;
+      }
+    return orders;
+  }
+
+  void report(uint32_t order)
+  {
+    std::map<uint32_t, uint64_t> orders = order_histogram();
+    std::map<uint32_t, uint64_t>::iterator order_itr;
+    std::map<uint64_t, uint64_t>::iterator class_itr;
+
+    std::cout << "Elements: " << elements
+              << " even: " << elements - odd_elements
+              << " odd: " << odd_elements << "\n";
+    for (order_itr = orders.begin(); order_itr != orders.end(); ++order_itr)
+      {
+        std::cout << "order " << order_itr->first << ": "
+                  << order_itr->second << "\n";
+      }
+    for (class_itr = classes.begin(); class_itr != classes.end(); ++class_itr)
+      {
+        std::cout << "class ";
+        print_cycle_type(class_itr->first, order);
+        std::cout << ": " << class_itr->second << "\n";
+      }
+  }
+
+  // The partial result of a shard, or a checkpoint when next_rank has
+  // not reached the end of the shard.  Written to a temporary name and
+  // renamed so a killed process never leaves a half written file.
+  bool write(const std::string &file_name, uint32_t order,
+             uint32_t shard, uint32_t shards, uint64_t next_rank)
+  {
+    std::string temporary = file_name + ".tmp";
+    std::ofstream out(temporary.c_str());
+    std::map<uint64_t, uint64_t>::iterator itr;
+
+    out << partial_magic << "\n";
+    out << "order " << order << "\n";
+    out << "shard " << shard << " " << shards << "\n";
+    out << "next " << next_rank << "\n";
+    out << "elements " << elements << "\n";
+    out << "odd " << odd_elements << "\n";
+    for (itr = classes.begin(); itr != classes.end(); ++itr)
+      {
+        out << "class " << itr->first << " " << itr->second << "\n";
+      }
+    out.close();
+    if (!out || rename(temporary.c_str(), file_name.c_str()) != 0)
+      {
+        return false;
+      }
+    return true;
+  }
+
+  // Adds a partial result to this tally
+  bool read(const std::string &file_name, uint32_t &order,
+            uint32_t &shard, uint32_t &shards, uint64_t &next_rank)
+  {
+    std::ifstream in(file_name.c_str());
+    std::string magic;
+    std::string field;
+
+    if (!(in >> magic) || magic != partial_magic)
+      {
+        return false;
+      }
+    while (in >> field)
+      {
+        uint64_t key;
+        uint64_t count;
+
+        if (field == "order")
+          {
+            in >> order;
+          }
+        else if (field == "shard")
+          {
+            in >> shard >> shards;
+          }
+        else if (field == "next")
+          {
+            in >> next_rank;
+          }
+        else if (field == "elements" && in >> count)
+          {
+            elements += count;
+          }
+        else if (field == "odd" && in >> count)
+          {
+            odd_elements += count;
+          }
+        else if (field == "class" && in >> key >> count)
+          {
+            classes[key] += count;
+          }
+        else
+          {
+            return false;
+          }
+      }
+    return in.eof();
+  }
+
+  static const char *partial_magic;
+
+  uint64_t elements;
+  uint64_t odd_elements;
+  std::map<uint64_t, uint64_t> classes;
+
+ private:
+  std::unordered_map<uint64_t, uint64_t> local_classes;
+};
+
+const char *SnTally::partial_magic = "EnumerateSn-partial-1";
+
+// Ranks walked between chances to checkpoint
+const uint64_t checkpoint_segment = 1 << 24;
+
+// Combine the partial results of all N shards into one report
+static int32_t
+merge_shards(int32_t files, char *file_names[])
+{
+  SnTally tally;
+  std::set<uint32_t> shards_seen;
+  uint32_t order = 0;
+  uint32_t shards = 0;
+
+  for (int32_t idx = 0; idx < files; idx++)
+    {
+      uint32_t file_order = 0;
+      uint32_t shard = 0;
+      uint32_t file_shards = 0;
+      uint64_t next_rank = 0;
+      uint64_t first_rank = 0;
+      uint64_t last_rank = 0;
+
+      if (!tally.read(file_names[idx], file_order, shard, file_shards, next_rank))
+        {
+          std::cerr << "Error: cannot read partial result " << file_names[idx] << "\n";
+          return 1;
+        }
+      if (idx == 0)
+        {
+          order = file_order;
+          shards = file_shards;
+        }
+      if (file_order != order || file_shards != shards
+          || !shards_seen.insert(shard).second)
+        {
+          std::cerr << "Error: " << file_names[idx]
+                    << " does not belong with the other partial results\n";
+          return 1;
+        }
+      // A checkpoint of an unfinished shard is not a partial result
+      if (shard_rank_range(permutation_count(order), shard, shards,
+                           first_rank, last_rank) != GrpErr_OK
+          || next_rank != last_rank)
+        {
+          std::cerr << "Error: " << file_names[idx]
+                    << " is from an unfinished shard\n";
+          return 1;
+        }
+    }
+  if (shards == 0 || shards_seen.size() != shards)
+    {
+      std::cerr << "Error: only " << shards_seen.size() << " of "
+                << shards << " shards given\n";
+      return 1;
+    }
+  tally.report(order);
+  return 0;
+}
+
+void
+usage(char *cmd)
+{
+  std::cerr << "USAGE: " << cmd << " [OPTIONS]\n";
+  std::cerr << "       -s, --permutation <group_order> -- Enumerate the symmetric group Sn.\n";
+  std::cerr << "       -t, --threads <count>           -- Worker threads (default one per core).\n";
+  std::cerr << "       -v, --verify                    -- Compare with a single threaded walk.\n";
+  std::cerr << "       -k, --shard <k>/<N>             -- Only the ranks in shard k (0 based) of N.\n";
+  std::cerr << "       -o, --output <file>             -- Write the shard's partial result here.\n";
+  std::cerr << "       -m, --merge <file> [<file>...]  -- Report on the merged partial results.\n";
+  std::cerr << "       -c, --checkpoint <file>         -- Save the tallies and position here as the walk goes.\n";
+  std::cerr << "       -i, --interval <seconds>        -- Seconds between checkpoints (default 60).\n";
+  std::cerr << "       -R, --resume                    -- Continue from the checkpoint, or start from the\n";
+  std::cerr << "                                          beginning when there is none yet.\n";
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t order = 0;
+  uint32_t threads = 0;
+  bool verify = false;
+  bool merge = false;
+  uint32_t shard = 0;
+  uint32_t shards = 1;
+  std::string output;
+  std::string checkpoint_file;
+  uint32_t checkpoint_seconds = 60;
+  bool resume = false;
+  int32_t opt;
+
+  if (argc < 2)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  while (1)
+    {
+      int32_t option_index = 0;
+
+      static struct option long_options[] =
+        {
+          {"permutation", required_argument, 0,  's'},
+          {"threads",     required_argument, 0,  't'},
+          {"verify",      no_argument,       0,  'v'},
+          {"shard",       required_argument, 0,  'k'},
+          {"output",      required_argument, 0,  'o'},
+          {"merge",       no_argument,       0,  'm'},
+          {"checkpoint",  required_argument, 0,  'c'},
+          {"interval",    required_argument, 0,  'i'},
+          {"resume",      no_argument,       0,  'R'},
+          {"help",        no_argument,       0,  'h'},
+          {0,             0,                 0,   0 }
+        };
+
+      opt = getopt_long(argc, argv, "s:t:vk:o:mc:i:Rh", long_options, &option_index);
+      if (opt == -1)
+        {
+          break;
+        }
+      switch (opt)
+        {
+        case 's':
+          order = atoi(optarg);
+          break;
+        case 't':
+          threads = atoi(optarg);
+          break;
+        case 'v':
+          verify = true;
+          break;
+        case 'k':
+          if (sscanf(optarg, "%u/%u", &shard, &shards) != 2)
+            {
+              std::cerr << "Error: the shard " << optarg << " is not <k>/<N>\n";
+              usage(argv[0]);
+              return 1;
+            }
+          break;
+        case 'o':
+          output = optarg;
+          break;
+        case 'm':
+          merge = true;
+          break;
+        case 'c':
+          checkpoint_file = optarg;
+          break;
+        case 'i':
+          checkpoint_seconds = atoi(optarg);
+          break;
+        case 'R':
+          resume = true;
+          break;
+        case 'h':
+          usage(argv[0]);
+          return 0;
+        default:
+          usage(argv[0]);
+          return 1;
+        }
+    }
+
+  if (merge)
+    {
+      return merge_shards(argc - optind, argv + optind);
+    }
+  if (order == 0)
+    {
+      std::cerr << "Error: no order given\n";
+      usage(argv[0]);
+      return 1;
+    }
+
+  SnTally tally;
+  uint64_t first_rank;
+  uint64_t last_rank;
+  GrpErr_t error = shard_rank_range(permutation_count(order), shard, shards,
+                                    first_rank, last_rank);
+
+  uint64_t next_rank = first_rank;
+
+  if (error == GrpErr_OK && resume && checkpoint_file.empty())
+    {
+      std::cerr << "Note: --resume without --checkpoint, starting from the beginning\n";
+    }
+  if (error == GrpErr_OK && resume && !checkpoint_file.empty())
+    {
+      std::ifstream saved(checkpoint_file.c_str());
+      uint32_t saved_order = 0;
+      uint32_t saved_shard = 0;
+      uint32_t saved_shards = 0;
+
+      if (!saved)
+        {
+          std::cerr << "Note: no checkpoint " << checkpoint_file
+                    << " yet, starting from the beginning\n";
+        }
+      if (saved
+          && (!tally.read(checkpoint_file, saved_order, saved_shard,
+                          saved_shards, next_rank)
+              || saved_order != order || saved_shard != shard
+              || saved_shards != shards
+              || next_rank < first_rank || next_rank > last_rank))
+        {
+          std::cerr << "Error: " << checkpoint_file
+                    << " is not a checkpoint of this walk\n";
+          return 1;
+        }
+    }
+
+  // The walk goes in segments of ranks so the tallies can be saved
+  // between them
+  time_t last_checkpoint = time(NULL);
+
+  while (error == GrpErr_OK && next_rank < last_rank)
+    {
+      uint64_t segment_end = std::min(last_rank, next_rank + checkpoint_segment);
+
+      error = parallel_for_each_rank(order, next_rank, segment_end,
+                                     tally, threads);
+      next_rank = segment_end;
+
+      if (error == GrpErr_OK && !checkpoint_file.empty()
+          && time(NULL) - last_checkpoint >= static_cast<time_t>(checkpoint_seconds))
+        {
+          if (!tally.write(checkpoint_file, order, shard, shards, next_rank))
+            {
+              std::cerr << "Error: cannot write the checkpoint " << checkpoint_file << "\n";
+              return 1;
+            }
+          last_checkpoint = time(NULL);
+        }
+    }
+  if (error == GrpErr_VisitStopped)
+    {
+      std::cerr << "Error: a visitor stopped the walk early, so there is no result\n";
+      return 1;
+    }
+  if (error != GrpErr_OK)
+    {
+      std::cerr << "Error: " << error << ": " << get_error_msg(error) << "\n";
+      usage(argv[0]);
+      return 1;
+    }
+  if (shards > 1 && output.empty())
+    {
+      output = "EnumerateSn_" + std::to_string(order) + "_"
+        + std::to_string(shard) + "_of_" + std::to_string(shards) + ".part";
+    }
+  if (!output.empty() && !tally.write(output, order, shard, shards, next_rank))
+    {
+      std::cerr << "Error: cannot write the partial result to " << output << "\n";
+      return 1;
+    }
+  if (!checkpoint_file.empty())
+    {
+      remove(checkpoint_file.c_str());
+    }
+  tally.report(order);
+
+  if (verify && shards == 1)
+    {
+      SnTally single;
+      SnTally *worker = static_cast<SnTally *>(single.clone());
+
+      for_each_Sn(order, [&](const std::string &element_value)
+        {
+          return worker->visit(element_value, 0,
+                               is_odd_element_value(element_value));
+        });
+      single.merge(*worker);
+      delete worker;
+
+      std::cout << " 1: Does the parallel walk match the single threaded one? ---------- ";
+      std::cout << ((single.elements == tally.elements
+                     && single.odd_elements == tally.odd_elements
+                     && single.classes == tally.classes) ? "PASS\n" : "FAIL\n");
+
+      FirstOdd first_odd;
+
+      std::cout << " 2: Is a walk a visitor stops told apart from a full one? ---------- ";
+      std::cout << ((parallel_for_each_Sn(order, first_odd, threads) == GrpErr_VisitStopped)
+                    ? "PASS\n" : "FAIL\n");
+    }
+  return 0;
+}
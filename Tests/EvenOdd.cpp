@@ -25,64 +25,45 @@
 
 #include <stdint.h>
 
-#include <utility>  // for sawp
 #include <GroupElement.h>
+#include <GroupStream.h>
+#include <CycleNotation.h>
 
-void permute(std::string & a, int32_t l, int32_t r);
+// Each permutation is visited once as it is generated; nothing is kept
+bool
+print_element(const std::string &element_value)
+{
+  GroupElement element;
+
+  element.set_element(element_value);
 
+  char cycles[max_cycle_text];
 
+  format_cycle_value(element_value.data(), element_value.size(), cycles);
+  std::cout << "\t" << element << "    " << element.get_inverse() << "     "
+            << (element.is_odd() ? "Odd " : "Even") << "        " << cycles << "\n";
+  return true;
+}
 
 int
 main(int32_t argc, char *argv[])
 {
   if (argc < 2)
     {
-      std::cout << "You need to supply the Group order [2-8]\n";
+      std::cout << "You need to supply the Group order [2-" << max_order << "]\n";
       return 0;
     }
 
   uint32_t group_order = atoi(argv[1]);
-  GroupElement identity_element;
-  std::string str;
 
   fprintf(stderr, "Setting group order to %u\n", group_order);
-  identity_element.set_order(group_order);
-  str = identity_element.get_element();
-
-  std::cout << "      Element   Inverse Even or Odd\n";
-  permute(str, 0, group_order - 1);
 
-  return 1;
-}
-
-void permute(std::string & a, int l, int r)
-{
-  // Base case
-  if (l == r)
+  std::cout << "      Element   Inverse Even or Odd Cycles\n";
+  GrpErr_t error = for_each_Sn(group_order, print_element);
+  if (error != GrpErr_OK)
     {
-      GroupElement element;
-
-      element.set_element(a);
-
-      std::string e = element.get_inverse();
-
-      std::cout << "\t" << element << "    " << element.get_inverse() << "     "
-                << (element.is_odd() ? "Odd" : "Even") << "\n";
+      std::cerr << "Error: " << error << ": " << get_error_msg(error) << "\n";
     }
-  else
-    {
-      // Permutations made
-      for (int32_t i = l; i <= r; i++)
-        {
 
-          // Swapping done
-          std::swap(a[l], a[i]);
-
-          // Recursion called
-          permute(a, l+1, r);
-
-          //backtrack
-          std::swap(a[l], a[i]);
-        }
-    }
+  return 1;
 }
@@ -0,0 +1,222 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Factorizations.cpp: Words in generators for elements                      */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <CycleNotation.h>
+#include <CayleyGraph.h>
+#include <Factorization.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " [<n>]\n";
+  std::cout << "       Checks shortest and stabilizer chain words on small groups, then\n";
+  std::cout << "       factors random elements of Sn over (0 1) and (0 1 ... n-1)\n";
+  std::cout << "       (default n = 12)\n";
+}
+
+// (0 1) and (0 1 ... n-1)
+static std::vector<GroupElement>
+swap_and_cycle(uint32_t order)
+{
+  std::vector<GroupElement> generators;
+  std::string cycle = "(";
+
+  for (uint32_t i = 0; i < order; i++)
+    {
+      cycle += std::to_string(i) + (i + 1 < order ? " " : ")");
+    }
+  generators.push_back(cycles_element("(0 1)", order));
+  generators.push_back(cycles_element(cycle, order));
+  return generators;
+}
+
+static bool
+word_gives(const std::vector<GroupElement> &generators, const Word_t &word,
+           const GroupElement &target)
+{
+  GroupElement product;
+
+  return (evaluate_word(generators, word, product) == GrpErr_OK)
+         && (product == target);
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t order = 12;
+
+  if (argc > 1)
+    {
+      order = atoi(argv[1]);
+    }
+  if (order < 2 || order > max_order)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      // Shortest words are as long as the Cayley graph distances
+      std::vector<GroupElement> generators = swap_and_cycle(6);
+      CayleyGraph graph;
+      bool pass = (graph.generate_Sn(6, generators) == GrpErr_OK)
+                  && (graph.word_lengths() == GrpErr_OK);
+
+      for (uint64_t v = 0; v < graph.size() && pass; v++)
+        {
+          std::string value;
+          GroupElement target;
+          Word_t word;
+
+          unrank_element_value(6, v, value);
+          target.set_order(6);
+          target.set_element(value);
+          pass = (shortest_word(generators, target, word) == GrpErr_OK)
+                 && (word.size() == graph.get_distances()[v])
+                 && word_gives(generators, word, target);
+        }
+      std::cout << " 1: Are the shortest words of S6 as long as its word lengths? ------- ";
+      report(pass);
+
+      // The chain factors every element of S6, and knows the order
+      FactorizationChain chain;
+      Group S6;
+
+      S6.generate_Sn(6);
+      pass = (chain.generate(generators) == GrpErr_OK) && (chain.size() == 720);
+      for (uint32_t idx = 0; idx < S6.size() && pass; idx++)
+        {
+          GroupElement target;
+          Word_t word;
+
+          S6.get_element(idx, target);
+          pass = (chain.factorize(target, word) == GrpErr_OK)
+                 && word_gives(generators, word, target);
+        }
+      std::cout << " 2: Does the stabilizer chain factor all of S6? --------------------- ";
+      report(pass);
+
+      // Only even elements are reached from the generators of A5
+      std::vector<GroupElement> even;
+      Word_t word;
+
+      even.push_back(cycles_element("(0 1 2)", 5));
+      even.push_back(cycles_element("(0 1 2 3 4)", 5));
+      pass = (chain.generate(even) == GrpErr_OK) && (chain.size() == 60)
+             && (chain.factorize(cycles_element("(0 1)", 5), word) == GrpErr_MissingElement)
+             && (shortest_word(even, cycles_element("(3 4)", 5), word) == GrpErr_MissingElement)
+             && (shortest_word(even, cycles_element("(0 2)(3 4)", 5), word) == GrpErr_OK)
+             && word_gives(even, word, cycles_element("(0 2)(3 4)", 5));
+      std::cout << " 3: Are elements outside the generated group refused? --------------- ";
+      report(pass);
+
+      // Too small a search falls back on the chain
+      std::mt19937 rng(2020);
+      GroupElement target = random_element(9, rng);
+
+      generators = swap_and_cycle(9);
+      pass = (shortest_word(generators, target, word, 1000) == GrpErr_ElementOverflow)
+             && (factorize_element(generators, target, word, 1000) == GrpErr_OK)
+             && word_gives(generators, word, target)
+             && (evaluate_word(generators, Word_t(1, 2), target) == GrpErr_IndexOutOfBounds)
+             && (evaluate_word(generators, Word_t(), target) == GrpErr_OK)
+             && (target.get_element() == "012345678");
+      std::cout << " 4: Does a search over its limit fall back on the chain? ------------ ";
+      report(pass);
+
+      // Timings
+      struct timespec start;
+      struct timespec now;
+      const uint32_t samples = 100;
+      uint64_t total_length = 0;
+      size_t longest = 0;
+
+      generators = swap_and_cycle(order);
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      chain.generate(generators);
+      clock_gettime(CLOCK_MONOTONIC, &now);
+
+      double seconds = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+
+      std::cout << "S" << order << " chain of " << chain.get_base_length()
+                << " levels built in " << seconds << " s\n";
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      pass = true;
+      for (uint32_t idx = 0; idx < samples; idx++)
+        {
+          target = random_element(order, rng);
+          pass = pass && (chain.factorize(target, word) == GrpErr_OK)
+                 && word_gives(generators, word, target);
+          total_length += word.size();
+          longest = std::max(longest, word.size());
+        }
+      clock_gettime(CLOCK_MONOTONIC, &now);
+      seconds = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+      std::cout << samples << " chain words: mean length " << total_length / samples
+                << ", longest " << longest << ", " << seconds / samples * 1e6
+                << " us each" << (pass ? "" : ", WRONG") << "\n";
+
+      if (order <= 10)
+        {
+          const uint32_t searches = 10;
+
+          total_length = 0;
+          clock_gettime(CLOCK_MONOTONIC, &start);
+          for (uint32_t idx = 0; idx < searches; idx++)
+            {
+              target = random_element(order, rng);
+              shortest_word(generators, target, word);
+              total_length += word.size();
+            }
+          clock_gettime(CLOCK_MONOTONIC, &now);
+          seconds = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+          std::cout << searches << " shortest words: mean length " << total_length / searches
+                    << ", " << seconds / searches * 1e3 << " ms each\n";
+        }
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
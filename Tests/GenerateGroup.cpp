@@ -24,16 +24,19 @@
 /******************************************************************************/
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <iostream>
 
 #include <GroupElement.h>
+#include <CycleNotation.h>
 
 void
 usage(char *cmd)
 {
-  std::cerr << "USAGE: " << cmd << " 01[2[3[4...]]]\n";
+  std::cerr << "USAGE: " << cmd << " 01[2[3[4...]]] | \"(0 1 2)(3 4)\" [<order>]\n";
+  std::cerr << "       Cycles take the given order or the least order they fit\n";
 }
 
 int32_t
@@ -42,21 +45,29 @@ main(int32_t argc, char *argv[])
   if (argc < 2)
     {
       usage(argv[0]);
+      return 0;
     }
 
   GroupElement GP;
   GroupElement Accumulator;
   GroupElement I;
-  GP.set_element(argv[1]);
-  Accumulator.set_element(argv[1]);
-  I.set_order(strlen(argv[1]));
+  uint32_t order = (argc > 2) ? atoi(argv[2]) : 0;
+  GrpErr_t error = parse_element_text(argv[1], order, GP);
 
-  std::cout << GP << "\n";
+  if (error != GrpErr_OK)
+    {
+      std::cerr << "Error: " << error << ": " << get_error_msg(error) << "\n";
+      return 0;
+    }
+  Accumulator = GP;
+  I.set_order(GP.get_order());
+
+  std::cout << GP << "  " << cycle_notation(GP) << "\n";
 
   while (Accumulator != I)
     {
       Accumulator *= GP;
-      std::cout << Accumulator << "\n";
+      std::cout << Accumulator << "  " << cycle_notation(Accumulator) << "\n";
     }
   return 0;
 }
@@ -0,0 +1,182 @@
+/******************************************************************************/
+/*                                                                            */
+/*  GroupActions.cpp: Orbits on points, tuples and subsets                    */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <CycleNotation.h>
+#include <GroupAction.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " [<k>]\n";
+  std::cout << "       Checks orbits and stabilizers on small groups, then times S16\n";
+  std::cout << "       acting on k-tuples (default k = 5)\n";
+}
+
+// Burnside: the orbit count is the mean number of fixed codes
+static uint64_t
+burnside_count(Group &G, const GroupAction &action)
+{
+  uint64_t fixed = 0;
+
+  for (uint32_t idx = 0; idx < G.size(); idx++)
+    {
+      GroupElement e;
+
+      G.get_element(idx, e);
+      for (uint64_t code = 0; code < action.size(); code++)
+        {
+          fixed += (action.image(code, e.get_element()) == code);
+        }
+    }
+  return fixed / G.size();
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t k = 5;
+
+  if (argc > 1)
+    {
+      k = atoi(argv[1]);
+    }
+  if (k == 0 || k > 7)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      // <(0 1 2)(3 4)> is C6 with orbits {0,1,2}, {3,4} and {5}
+      std::vector<GroupElement> generators(1, cycles_element("(0 1 2)(3 4)", 6));
+      GroupAction action;
+      bool pass = (action.generate(generators, GrpAction_Points) == GrpErr_OK)
+                  && (action.group_size() == 6) && (action.orbit_count() == 3)
+                  && (action.get_orbit_ids() == std::vector<uint32_t>({0, 0, 0, 1, 1, 2}))
+                  && (action.get_orbit_sizes() == std::vector<uint64_t>({3, 2, 1}))
+                  && (action.stabilizer_size(1) == 2) && (action.stabilizer_size(4) == 3)
+                  && (action.stabilizer_size(5) == 6);
+      std::cout << " 1: Are the point orbits and stabilizers of (0 1 2)(3 4) right? ----- ";
+      report(pass);
+
+      // Necklaces and bracelets: C8 and D8 on the k-subsets of the beads
+      Group C8;
+      Group D8;
+
+      C8.generate_Cn(8);
+      D8.generate_Dn(8);
+      pass = true;
+      for (uint32_t subset = 0; subset <= 8 && pass; subset++)
+        {
+          pass = (action.generate(C8, GrpAction_Subsets, subset) == GrpErr_OK)
+                 && (action.orbit_count() == burnside_count(C8, action))
+                 && (action.generate(D8, GrpAction_Subsets, subset) == GrpErr_OK)
+                 && (action.orbit_count() == burnside_count(D8, action));
+        }
+      pass = pass && (action.generate(D8, GrpAction_Subsets, 4) == GrpErr_OK)
+             && (action.orbit_count() == 8);
+      std::cout << " 2: Do the C8 and D8 subset orbits match Burnside's count? ---------- ";
+      report(pass);
+
+      // Orbit-stabilizer against counting the elements that fix each pair
+      Group S5;
+
+      S5.generate_Sn(5);
+      pass = (action.generate(S5, GrpAction_Tuples, 2) == GrpErr_OK)
+             && (action.orbit_count() == 2) && (action.size() == 25);
+      for (uint64_t code = 0; code < action.size() && pass; code++)
+        {
+          uint64_t fixing = 0;
+
+          for (uint32_t idx = 0; idx < S5.size(); idx++)
+            {
+              GroupElement e;
+
+              S5.get_element(idx, e);
+              fixing += (action.image(code, e.get_element()) == code);
+            }
+          pass = (action.stabilizer_size(code) == fixing);
+        }
+      std::cout << " 3: Do stabilizer sizes match the elements fixing each pair? -------- ";
+      report(pass);
+
+      // Codes round trip, and the generators alone give |G| for S12
+      std::vector<uint32_t> points;
+      uint64_t code = 0;
+
+      generators.assign(1, cycles_element("(0 1)", 12));
+      generators.push_back(cycles_element("(0 1 2 3 4 5 6 7 8 9 10 11)", 12));
+      pass = (action.generate(generators, GrpAction_Subsets, 4) == GrpErr_OK)
+             && (action.group_size() == 479001600) && (action.orbit_count() == 1)
+             && (action.stabilizer_size(17) == 24 * 40320);
+      for (uint64_t c = 0; c < action.size() && pass; c++)
+        {
+          action.decode(c, points);
+          pass = (action.encode(points, code) == GrpErr_OK) && (code == c)
+                 && (points[0] < points[1]) && (points[2] < points[3]);
+        }
+      points.assign(4, 3);
+      pass = pass && (action.encode(points, code) == GrpErr_ElementValueDuplicated)
+             && (action.generate(generators, GrpAction_Subsets, 13) == GrpErr_IndexOutOfBounds)
+             && (action.generate(generators, GrpAction_Tuples, 9) == GrpErr_ElementOverflow);
+      std::cout << " 4: Do codes round trip and bad actions fail? ----------------------- ";
+      report(pass);
+
+      // Timing
+      struct timespec start;
+      struct timespec now;
+
+      generators.assign(1, cycles_element("(0 1)", 16));
+      generators.push_back(cycles_element("(0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)", 16));
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      action.generate(generators, GrpAction_Tuples, k);
+      clock_gettime(CLOCK_MONOTONIC, &now);
+
+      double seconds = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+
+      std::cout << "S16 on " << action.size() << " " << k << "-tuples: "
+                << action.orbit_count() << " orbits in " << seconds << " s\n";
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
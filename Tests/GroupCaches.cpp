@@ -0,0 +1,214 @@
+/******************************************************************************/
+/*                                                                            */
+/*  GroupCaches.cpp: Groups kept in memory and on disk by key                 */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <GroupCache.h>
+#include <CycleNotation.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << "\n";
+  std::cout << "       Checks the group cache keys, its least recently used order and\n";
+  std::cout << "       its saved groups, then times repeated requests for A6\n";
+}
+
+// Applies action to each saved group file in the directory
+template <typename Action>
+static void
+for_each_file(const std::string &directory, Action action)
+{
+  DIR *dir = opendir(directory.c_str());
+  struct dirent *entry;
+
+  if (dir == NULL)
+    {
+      return;
+    }
+  while ((entry = readdir(dir)) != NULL)
+    {
+      if (entry->d_name[0] != '.')
+        {
+          action(directory + "/" + entry->d_name);
+        }
+    }
+  closedir(dir);
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  if (argc > 1)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      GroupCache cache;
+      std::shared_ptr<Group> first;
+      std::shared_ptr<Group> second;
+      Group D12;
+
+      D12.generate_Dn(12);
+
+      bool pass = (cache.generate(GrpGen_Dn, 12, first) == GrpErr_OK)
+                  && (cache.generate(GrpGen_Dn, 12, second) == GrpErr_OK)
+                  && (first == second) && same_elements(*first, D12)
+                  && (cache.get_hits() == 1) && (cache.get_misses() == 1)
+                  && (GroupCache::key(GrpGen_Dn, 12) == "Dn 12");
+      std::cout << " 1: Is D12 made once and then shared? ------------------------------- ";
+      report(pass);
+
+      // Order and repeats do not change the key
+      std::vector<GroupElement> generators;
+      std::vector<GroupElement> shuffled;
+      Group S5;
+
+      S5.generate_Sn(5);
+      generators.push_back(cycles_element("(0 1 2 3 4)", 5));
+      generators.push_back(cycles_element("(0 1)", 5));
+      shuffled.push_back(generators[1]);
+      shuffled.push_back(generators[0]);
+      shuffled.push_back(generators[1]);
+      pass = (cache.generate(generators, first) == GrpErr_OK)
+             && (cache.generate(shuffled, second) == GrpErr_OK)
+             && (first == second) && same_elements(*first, S5)
+             && (GroupCache::key(shuffled) == "5: 10234 12340")
+             && (cache.generate(GrpGen_FromFile, 0, first) == GrpErr_UnimplimentedFunction);
+      std::cout << " 2: Do shuffled generators find the same closure? ------------------- ";
+      report(pass);
+
+      // A4 is used again before D4 arrives, so C5 is the one dropped
+      GroupCache small(2);
+
+      small.generate(GrpGen_An, 4, first);
+      small.generate(GrpGen_Cn, 5, first);
+      small.generate(GrpGen_An, 4, first);
+      small.generate(GrpGen_Dn, 4, first);
+
+      uint64_t misses = small.get_misses();
+
+      small.generate(GrpGen_An, 4, first);
+      pass = (small.size() == 2) && (small.get_misses() == misses)
+             && (small.generate(GrpGen_Cn, 5, first) == GrpErr_OK)
+             && (small.get_misses() == misses + 1) && (first->size() == 5);
+      std::cout << " 3: Is the least recently used group the one dropped? --------------- ";
+      report(pass);
+
+      // A fresh cache on the same directory loads instead of generating
+      char directory_template[] = "/tmp/GroupCachesXXXXXX";
+      std::string directory = mkdtemp(directory_template);
+      GroupCache writer(4, directory);
+      GroupCache reader(4, directory);
+      Group A6;
+
+      A6.generate_An(6);
+      writer.generate(GrpGen_An, 6, first);
+      pass = (reader.generate(GrpGen_An, 6, second) == GrpErr_OK)
+             && (reader.get_disk_hits() == 1) && (reader.get_misses() == 0)
+             && same_elements(*second, A6)
+             && (second->get_generators().size() == first->get_generators().size());
+
+      // A file whose second value repeats the first is made again
+      const size_t value_bytes = A6.size() * A6.get_element_order();
+      GroupCache duplicated(4, directory);
+
+      for_each_file(directory, [value_bytes](const std::string &name)
+        {
+          std::fstream file(name.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+          std::string first(6, '\0');
+
+          file.seekg(-static_cast<std::streamoff>(value_bytes), std::ios::end);
+          file.read(&first[0], first.size());
+          file.write(first.data(), first.size());
+        });
+      pass = pass && (duplicated.generate(GrpGen_An, 6, second) == GrpErr_OK)
+             && (duplicated.get_disk_hits() == 0) && (duplicated.get_misses() == 1)
+             && same_elements(*second, A6);
+
+      // So is a truncated one
+      GroupCache repair(4, directory);
+
+      for_each_file(directory, [](const std::string &name)
+        {
+          if (truncate(name.c_str(), 40) != 0)
+            {
+              std::cerr << "Cannot truncate " << name << "\n";
+            }
+        });
+      pass = pass && (repair.generate(GrpGen_An, 6, second) == GrpErr_OK)
+             && (repair.get_disk_hits() == 0) && (repair.get_misses() == 1)
+             && same_elements(*second, A6);
+      std::cout << " 4: Are saved groups loaded and damaged ones made again? ------------ ";
+      report(pass);
+
+      for_each_file(directory, [](const std::string &name)
+        {
+          unlink(name.c_str());
+        });
+      rmdir(directory.c_str());
+
+      const uint32_t requests = 1000000;
+      uint32_t found = 0;
+      struct timespec start;
+      struct timespec now;
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (uint32_t idx = 0; idx < requests; idx++)
+        {
+          found += (writer.generate(GrpGen_An, 6, second) == GrpErr_OK);
+        }
+      clock_gettime(CLOCK_MONOTONIC, &now);
+
+      double seconds = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+
+      std::cout << requests << " cached requests for A6: " << seconds / requests * 1e6
+                << " us each" << (found == requests ? "" : ", WRONG") << "\n";
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
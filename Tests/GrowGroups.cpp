@@ -0,0 +1,136 @@
+/******************************************************************************/
+/*                                                                            */
+/*  GrowGroups.cpp: Growing a closed group one generator at a time            */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <time.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <CycleNotation.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << "\n";
+  std::cout << "       Checks add_generator against generate, then times growing A8\n";
+  std::cout << "       to S8 against generating S8 from scratch\n";
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  if (argc > 1)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      Group S5;
+      Group C5;
+      GroupElement rotation = cycles_element("(0 1 2 3 4)", 5);
+      uint32_t added;
+
+      S5.generate_Sn(5);
+      C5.generate(rotation);
+
+      bool pass = (C5.add_generator(cycles_element("(0 1)", 5), added) == GrpErr_OK)
+                  && (added == 115) && same_elements(C5, S5)
+                  && (C5.get_generators().size() == 2);
+      std::cout << " 1: Does adding (0 1) to C5 give S5 and its 115 new elements? ------- ";
+      report(pass);
+
+      // An empty group starts as the trivial group
+      Group grown;
+      Group A5;
+
+      A5.generate_An(5);
+      pass = (grown.add_generator(cycles_element("(0 1 2)", 5), added) == GrpErr_OK)
+             && (added == 2) && (grown.size() == 3)
+             && (grown.add_generator(cycles_element("(2 3 4)", 5), added) == GrpErr_OK)
+             && (added == 57) && same_elements(grown, A5)
+             && (grown.add_generator(cycles_element("(1 2 3)", 5), added) == GrpErr_OK)
+             && (added == 0) && (grown.get_generators().size() == 2)
+             && (grown.add_generator(cycles_element("(3 4)", 5), added) == GrpErr_OK)
+             && (added == 60) && same_elements(grown, S5);
+      std::cout << " 2: Does the trivial group grow through A5 to S5, skipping members? - ";
+      report(pass);
+
+      // A group given by generators alone is generated first
+      std::vector<GroupElement> generators;
+      Group C6;
+      Group S6;
+
+      generators.push_back(cycles_element("(0 1 2 3 4 5)", 6));
+      C6.set_generators(generators);
+      S6.generate_Sn(6);
+      pass = (S5.add_generator(cycles_element("(0 5)", 6), added)
+              == GrpErr_IncompatibleGroupElement)
+             && (S5.size() == 120)
+             && (C6.add_generator(cycles_element("(0 1)", 6), added) == GrpErr_OK)
+             && (added == 714) && same_elements(C6, S6);
+      std::cout << " 3: Are bad orders refused and set_generators groups grown? --------- ";
+      report(pass);
+
+      // A8 has 20160 elements and one transposition doubles it
+      Group A8;
+      Group S8;
+      GroupElement transposition = cycles_element("(0 1)", 8);
+      struct timespec start;
+
+      A8.generate_An(8);
+      generators = A8.get_generators();
+      generators.push_back(transposition);
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      A8.add_generator(transposition, added);
+      double grow_seconds = seconds_since(start);
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      S8.generate(generators);
+      double generate_seconds = seconds_since(start);
+
+      pass = (added == 20160) && same_elements(A8, S8);
+      std::cout << " 4: Does growing A8 by (0 1) match generating S8 from scratch? ------ ";
+      report(pass);
+
+      std::cout << "A8 grown to S8 in " << grow_seconds << " s, generated from "
+                << generators.size() << " generators in " << generate_seconds << " s\n";
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
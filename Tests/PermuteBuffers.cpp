@@ -0,0 +1,209 @@
+/******************************************************************************/
+/*                                                                            */
+/*  PermuteBuffers.cpp: Checks and times group elements acting on data        */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <ElementAction.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " [<megabytes>]\n";
+  std::cout << "       Checks elements acting on buffers for every order and item size,\n";
+  std::cout << "       then reports the throughput over a buffer of the given size (default 256)\n";
+}
+
+// out[g[i]] = in[i] item by item
+static void
+reference(const GroupElement &g, const std::vector<char> &in,
+          std::vector<char> &out, size_t item_size)
+{
+  std::string value = g.get_element();
+  size_t order = value.size();
+  size_t items = in.size() / item_size;
+
+  out.resize(in.size());
+  for (size_t first = 0; first < items; first += order)
+    {
+      for (size_t i = 0; i < order; i++)
+        {
+          memcpy(&out[(first + value[i] - '0') * item_size],
+                 &in[(first + i) * item_size], item_size);
+        }
+    }
+}
+
+static bool
+check_sizes(bool in_place)
+{
+  const size_t sizes[] = { 1, 2, 3, 4, 8, 12 };
+  std::mt19937 rng(2020);
+
+  for (size_t item_size : sizes)
+    {
+      for (uint32_t order = 1; order <= max_order; order++)
+        {
+          for (size_t blocks = 0; blocks < 40; blocks += 13)
+            {
+              GroupElement g = random_element(order, rng);
+              std::vector<char> in(blocks * order * item_size);
+              std::vector<char> expected;
+              std::vector<char> out(in.size());
+
+              for (size_t b = 0; b < in.size(); b++)
+                {
+                  in[b] = rng();
+                }
+              reference(g, in, expected, item_size);
+              if (in_place)
+                {
+                  out = in;
+                  apply_element_in_place(g, out.data(), blocks * order,
+                                         item_size);
+                }
+              else
+                {
+                  apply_element(g, in.data(), out.data(), blocks * order,
+                                item_size);
+                }
+              if (out != expected)
+                {
+                  return false;
+                }
+            }
+        }
+    }
+  return true;
+}
+
+template <typename T>
+static void
+throughput(const char *name, size_t megabytes, uint32_t order, bool in_place)
+{
+  std::mt19937 rng(1);
+  GroupElement g = random_element(order, rng);
+  size_t items = megabytes * 1024 * 1024 / sizeof(T) / order * order;
+  std::vector<T> in(items, 1);
+  std::vector<T> out(items, 2);
+  struct timespec start;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  if (in_place)
+    {
+      apply_element_in_place(g, in.data(), items);
+    }
+  else
+    {
+      apply_element(g, in.data(), out.data(), items);
+    }
+
+  double seconds = seconds_since(start);
+
+  std::cout << "    " << name << std::string(30 - strlen(name), ' ')
+            << (in_place ? "in place " : "         ")
+            << items * sizeof(T) / seconds / 1e9 << " GB/s\n";
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  size_t megabytes = 256;
+
+  if (argc > 1)
+    {
+      megabytes = atoi(argv[1]);
+    }
+  if (megabytes == 0)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      std::mt19937 rng(7);
+      GroupElement a = random_element(9, rng);
+      GroupElement b = random_element(9, rng);
+      std::vector<uint32_t> data(9 * 5);
+      std::vector<uint32_t> by_b(data.size());
+      std::vector<uint32_t> by_a_b(data.size());
+      std::vector<uint32_t> by_ab(data.size());
+
+      for (size_t i = 0; i < data.size(); i++)
+        {
+          data[i] = i;
+        }
+      apply_element(b, data.data(), by_b.data(), data.size());
+      apply_element(a, by_b.data(), by_a_b.data(), by_b.size());
+      apply_element(a * b, data.data(), by_ab.data(), data.size());
+
+      std::cout << " 1: Does a * b act as b and then a? --------------------------------- ";
+      report(by_ab == by_a_b);
+      std::cout << " 2: Does apply_element move every item size correctly? -------------- ";
+      report(check_sizes(false));
+      std::cout << " 3: Does apply_element_in_place match it? --------------------------- ";
+      report(check_sizes(true));
+
+      std::cout << "Permuting " << megabytes << " MB:\n";
+
+      std::vector<char> in(megabytes * 1024 * 1024, 1);
+      std::vector<char> out(in.size(), 2);
+      struct timespec start;
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      memcpy(out.data(), in.data(), in.size());
+      std::cout << "    memcpy                                 "
+                << in.size() / seconds_since(start) / 1e9 << " GB/s\n";
+
+      throughput<uint8_t>("bytes, order 16", megabytes, 16, false);
+      throughput<uint8_t>("bytes, order 7", megabytes, 7, false);
+      throughput<uint16_t>("16 bit words, order 12", megabytes, 12, false);
+      throughput<uint32_t>("32 bit words, order 8", megabytes, 8, false);
+      throughput<uint32_t>("32 bit words, order 16", megabytes, 16, false);
+      throughput<uint64_t>("64 bit words, order 4", megabytes, 4, false);
+      throughput<uint64_t>("64 bit words, order 16", megabytes, 16, false);
+      throughput<uint8_t>("bytes, order 16", megabytes, 16, true);
+      throughput<uint64_t>("64 bit words, order 16", megabytes, 16, true);
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,214 @@
+/******************************************************************************/
+/*                                                                            */
+/*  PolygonGroups.cpp: Closed form Cn and Dn against the permutation groups   */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <OrderProfile.h>
+#include <PolygonElement.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " [<vertices>]\n";
+  std::cout << "       Checks the closed form polygon groups against Cn and Dn up to 12\n";
+  std::cout << "       vertices, then works through Dn for the given vertices (default 5000)\n";
+}
+
+// Every product, inverse, order and equality of the closed form Dn
+// against the permutations it stands for, read both ways round the
+// polygon
+static bool
+check_dihedral(uint32_t vertices)
+{
+  std::vector<DihedralElement> elements;
+
+  for (uint32_t step = 0; step < vertices; step++)
+    {
+      elements.push_back(DihedralElement(vertices, step, false));
+      elements.push_back(DihedralElement(vertices, step, true));
+    }
+
+  for (uint32_t a = 0; a < elements.size(); a++)
+    {
+      for (GrpElDirection_t direction : { GrpElDirection_left,
+                                          GrpElDirection_right })
+        {
+          GroupElement x;
+          GroupElement x_inverse;
+
+          elements[a].to_element(x, direction);
+          elements[a].inverse().to_element(x_inverse, direction);
+          if (x_inverse.get_element() != x.get_inverse() ||
+              elements[a].order() !=
+              element_value_order(x.get_element().c_str(), vertices))
+            {
+              return false;
+            }
+          for (uint32_t b = 0; b < elements.size(); b++)
+            {
+              GroupElement y;
+              GroupElement xy;
+
+              elements[b].to_element(y, direction);
+              (elements[a] * elements[b]).to_element(xy, direction);
+              if ((xy != x * y) || ((elements[a] == elements[b]) != (x == y)))
+                {
+                  return false;
+                }
+            }
+        }
+    }
+  return true;
+}
+
+// The elements read left to right are exactly those of the Group
+static bool
+same_elements(Group &G, uint32_t vertices, bool flips)
+{
+  uint32_t count = 0;
+
+  for (uint32_t step = 0; step < vertices; step++)
+    {
+      for (uint32_t flip = 0; flip <= (flips ? 1 : 0); flip++)
+        {
+          GroupElement element;
+          uint32_t idx;
+
+          if (flip)
+            {
+              DihedralElement(vertices, step, true).to_element(element);
+            }
+          else
+            {
+              RotationElement(vertices, step).to_element(element);
+            }
+          if (!G.find_element(element, idx))
+            {
+              return false;
+            }
+          count++;
+        }
+    }
+  return count == G.size();
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t big = 5000;
+
+  if (argc > 1)
+    {
+      big = atoi(argv[1]);
+    }
+  if (big < 3)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      bool pass = true;
+
+      for (uint32_t vertices = 3; vertices <= 12; vertices++)
+        {
+          Group Cn;
+          Group Dn;
+
+          Cn.generate_Cn(vertices);
+          Dn.generate_Dn(vertices);
+          pass = pass && same_elements(Cn, vertices, false) &&
+            same_elements(Dn, vertices, true);
+        }
+      std::cout << " 1: Are the closed forms the elements of Cn and Dn? ----------------- ";
+      report(pass);
+
+      pass = true;
+      for (uint32_t vertices = 1; vertices <= 12; vertices++)
+        {
+          pass = pass && check_dihedral(vertices);
+        }
+      std::cout << " 2: Do products, inverses and orders match the permutations? -------- ";
+      report(pass);
+
+      // Rotations of order d number phi(d) for each divisor d, and the
+      // flips all have order two
+      std::vector<uint32_t> histogram(big + 1, 0);
+      DihedralElement r(big, 1, false);
+      DihedralElement s(big, 0, true);
+      DihedralElement element(big, 0, false);
+
+      for (uint32_t step = 0; step < big; step++)
+        {
+          histogram[element.order()]++;
+          histogram[(element * s).order()]++;
+          element = element * r;
+        }
+      pass = (element == DihedralElement(big, 0, false));
+      for (uint32_t d = 1; d <= big; d++)
+        {
+          uint32_t expected = (big % d == 0) ? euler_phi(d) : 0;
+
+          if (d == 2)
+            {
+              expected += big;
+            }
+          pass = pass && histogram[d] == expected;
+        }
+      std::string label = " 3: Does D" + std::to_string(big) +
+        " have the expected order counts? ";
+
+      std::cout << label << std::string(69 - label.size(), '-') << " ";
+      report(pass);
+
+      // srs = r^-1 everywhere in the group
+      pass = true;
+      for (uint32_t step = 0; step < big; step++)
+        {
+          DihedralElement rotation(big, step, false);
+
+          pass = pass && (s * rotation * s == rotation.inverse());
+        }
+      std::cout << " 4: Do the flips conjugate each rotation to its inverse? ------------ ";
+      report(pass);
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
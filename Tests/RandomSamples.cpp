@@ -0,0 +1,264 @@
+/******************************************************************************/
+/*                                                                            */
+/*  RandomSamples.cpp: Seeded random elements of groups                       */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <CycleNotation.h>
+#include <RandomElements.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " [<threads>]\n";
+  std::cout << "       Checks the seeded samplers, then times them on S16 with one\n";
+  std::cout << "       stream per thread (default 1 thread)\n";
+}
+
+// Pearson's statistic for draws samples spread over the elements of G.
+// Every sample must be in G.
+template <class Sampler>
+static double
+chi_square(Sampler &sampler, Group &G, uint32_t draws, bool &members)
+{
+  std::vector<uint32_t> counts(G.size(), 0);
+  char value[max_order];
+
+  members = true;
+  for (uint32_t idx = 0; idx < draws; idx++)
+    {
+      uint32_t element_index;
+
+      sampler.next(value);
+      if (!G.find_value(value, element_index))
+        {
+          members = false;
+          return 0;
+        }
+      counts[element_index]++;
+    }
+
+  double expected = static_cast<double>(draws) / G.size();
+  double statistic = 0;
+
+  for (uint32_t idx = 0; idx < counts.size(); idx++)
+    {
+      statistic += (counts[idx] - expected) * (counts[idx] - expected) / expected;
+    }
+  return statistic;
+}
+
+typedef struct
+{
+  bool uniform;
+  uint32_t stream;
+  uint32_t draws;
+  uint64_t checksum;
+} TimingWork;
+
+static void
+timing_worker(TimingWork *work)
+{
+  std::vector<GroupElement> generators;
+  UniformSampler uniform;
+  ProductReplacement replacement;
+  char value[max_order];
+
+  generators.push_back(cycles_element("(0 1)", 16));
+  generators.push_back(cycles_element("(0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15)", 16));
+  uniform.generate(GrpGen_Sn, 16, 2020, work->stream);
+  replacement.generate(generators, 2020, work->stream);
+
+  work->checksum = 0;
+  for (uint32_t idx = 0; idx < work->draws; idx++)
+    {
+      if (work->uniform)
+        {
+          uniform.next(value);
+        }
+      else
+        {
+          replacement.next(value);
+        }
+      work->checksum += value[idx % 16];
+    }
+}
+
+static double
+time_streams(bool uniform, uint32_t threads, uint32_t draws)
+{
+  std::vector<TimingWork> work(threads);
+  std::vector<std::thread> workers;
+  struct timespec start;
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      work[t].uniform = uniform;
+      work[t].stream = t;
+      work[t].draws = draws;
+      workers.push_back(std::thread(timing_worker, &work[t]));
+    }
+  for (uint32_t t = 0; t < threads; t++)
+    {
+      workers[t].join();
+    }
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t threads = 1;
+
+  if (argc > 1)
+    {
+      threads = atoi(argv[1]);
+    }
+  if (threads == 0)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      // One seed and stream give one sequence; other streams differ
+      SampleRng a(7, 0);
+      SampleRng b(7, 0);
+      SampleRng c(7, 1);
+      bool pass = true;
+      bool differs = false;
+
+      for (uint32_t idx = 0; idx < 1000; idx++)
+        {
+          uint64_t x = a.next();
+
+          pass = pass && (x == b.next());
+          differs = differs || (x != c.next());
+          pass = pass && (a.below(37) < 37) && (b.below(37) < 37);
+          c.below(37);
+        }
+      std::cout << " 1: Is each seed and stream reproducible and the streams distinct? -- ";
+      report(pass && differs);
+
+      // Chi-square against the 99.9% point for the degrees of freedom:
+      // 35.5 for 11, 49.7 for 23, 99.6 for 59 and 169.6 for 119
+      UniformSampler uniform;
+      Group S4;
+      Group A5;
+      Group D12;
+      Group S5;
+      bool members = false;
+
+      S4.generate_Sn(4);
+      A5.generate_An(5);
+      D12.generate_Dn(12);
+      S5.generate_Sn(5);
+      pass = (uniform.generate(GrpGen_Sn, 4, 1) == GrpErr_OK)
+             && (uniform.size() == 24)
+             && (chi_square(uniform, S4, 240000, members) < 49.7) && members
+             && (uniform.generate(GrpGen_An, 5, 2) == GrpErr_OK)
+             && (uniform.size() == 60)
+             && (chi_square(uniform, A5, 600000, members) < 99.6) && members
+             && (uniform.generate(GrpGen_Dn, 12, 3) == GrpErr_OK)
+             && (uniform.size() == 24)
+             && (chi_square(uniform, D12, 240000, members) < 49.7) && members
+             && (uniform.generate(GrpGen_Cn, 12, 4) == GrpErr_OK)
+             && (uniform.size() == 12);
+
+      Group C12;
+
+      C12.generate_Cn(12);
+      pass = pass && (chi_square(uniform, C12, 120000, members) < 35.5) && members;
+      std::cout << " 2: Are the Sn, An, Dn and Cn samples uniform over the group? ------- ";
+      report(pass);
+
+      // Product replacement stays in the generated group and spreads
+      // over it once warmed up
+      ProductReplacement replacement;
+      std::vector<GroupElement> generators;
+
+      generators.push_back(cycles_element("(0 1 2)", 5));
+      generators.push_back(cycles_element("(0 1 2 3 4)", 5));
+      pass = (replacement.generate(generators, 5) == GrpErr_OK)
+             && (chi_square(replacement, A5, 600000, members) < 99.6) && members;
+      generators.assign(1, cycles_element("(0 1)", 5));
+      generators.push_back(cycles_element("(0 1 2 3 4)", 5));
+      pass = pass && (replacement.generate(generators, 6) == GrpErr_OK)
+             && (chi_square(replacement, S5, 1200000, members) < 169.6) && members;
+      std::cout << " 3: Does product replacement spread evenly over A5 and S5? ---------- ";
+      report(pass);
+
+      // Equal seeds replay the same samples
+      ProductReplacement again;
+      GroupElement x;
+      GroupElement y;
+
+      pass = (replacement.generate(generators, 9, 3, 50) == GrpErr_OK)
+             && (again.generate(generators, 9, 3, 50) == GrpErr_OK);
+      for (uint32_t idx = 0; idx < 1000 && pass; idx++)
+        {
+          pass = (replacement.next(x) == GrpErr_OK) && (again.next(y) == GrpErr_OK)
+                 && (x == y);
+        }
+      generators.push_back(cycles_element("(0 1)", 4));
+      pass = pass && (replacement.generate(generators, 9) == GrpErr_OrderMismatch)
+             && (replacement.generate(std::vector<GroupElement>(), 9) == GrpErr_UndefinedGroupOrder)
+             && (uniform.generate(GrpGen_Sn, max_order + 1, 9) == GrpErr_ElementOverflow)
+             && (uniform.generate(GrpGen_Cyclic, 5, 9) == GrpErr_UnimplimentedFunction);
+      std::cout << " 4: Do equal seeds replay and bad requests fail? -------------------- ";
+      report(pass);
+
+      const uint32_t draws = 4000000;
+      double seconds = time_streams(true, threads, draws);
+
+      std::cout << "Uniform S16 on " << threads << " streams: "
+                << draws * threads / seconds / 1e6 << " million/s\n";
+      seconds = time_streams(false, threads, draws);
+      std::cout << "Product replacement S16 on " << threads << " streams: "
+                << draws * threads / seconds / 1e6 << " million/s\n";
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
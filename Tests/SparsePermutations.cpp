@@ -0,0 +1,213 @@
+/******************************************************************************/
+/*                                                                            */
+/*  SparsePermutations.cpp: Sparse permutations against the dense elements    */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <GroupElement.h>
+#include <GroupStream.h>
+#include <SparsePermutation.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " [<degree> [<support>]]\n";
+  std::cout << "       Checks sparse permutations against all of S6, then works with\n";
+  std::cout << "       permutations of the given degree (default 50000) moving about\n";
+  std::cout << "       support points (default 40)\n";
+}
+
+// Cycles through support random points of the degree
+static SparsePermutation
+random_sparse(uint32_t degree, uint32_t support, std::mt19937 &rng)
+{
+  std::vector<uint32_t> points;
+  std::vector<SparsePermutation::Move_t> moves;
+  SparsePermutation p;
+
+  while (points.size() < support)
+    {
+      uint32_t point = rng() % degree;
+
+      if (std::find(points.begin(), points.end(), point) == points.end())
+        {
+          points.push_back(point);
+        }
+    }
+
+  std::vector<uint32_t> images = points;
+
+  std::shuffle(images.begin(), images.end(), rng);
+  for (uint32_t idx = 0; idx < support; idx++)
+    {
+      moves.push_back(SparsePermutation::Move_t(points[idx], images[idx]));
+    }
+  p.set_moves(degree, moves);
+  return p;
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t degree = 50000;
+  uint32_t support = 40;
+
+  if (argc > 1)
+    {
+      degree = atoi(argv[1]);
+    }
+  if (argc > 2)
+    {
+      support = atoi(argv[2]);
+    }
+  if (degree < 2 || support > degree)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      // Every pair of S6 both ways
+      std::vector<std::string> values;
+      bool pass = true;
+
+      for_each_Sn(6, [&](const std::string &value) -> bool
+        {
+          values.push_back(value);
+          return true;
+        });
+      for (size_t a = 0; a < values.size() && pass; a++)
+        {
+          GroupElement x;
+          GroupElement round_trip;
+          SparsePermutation sx;
+          std::string inverse;
+
+          x.set_order(6);
+          x.set_element(values[a]);
+          sx.set_element(x);
+          sx.to_element(round_trip);
+          invert_element_value(values[a], inverse);
+
+          GroupElement x_inverse;
+
+          sx.inverse().to_element(x_inverse);
+          pass = (round_trip == x && x_inverse.get_element() == inverse &&
+                  sx.is_odd() == x.is_odd());
+          for (size_t b = 0; b < values.size() && pass; b += 7)
+            {
+              GroupElement y;
+              GroupElement xy;
+              SparsePermutation sy;
+
+              y.set_order(6);
+              y.set_element(values[b]);
+              sy.set_element(y);
+              (sx * sy).to_element(xy);
+              pass = (xy == x * y);
+            }
+        }
+      std::cout << " 1: Do products, inverses and parity match the dense S6? ------------ ";
+      report(pass);
+
+      SparsePermutation bad;
+      GroupElement dense;
+      std::vector<SparsePermutation::Move_t> moves;
+
+      moves.push_back(SparsePermutation::Move_t(3, 9));
+      moves.push_back(SparsePermutation::Move_t(9, 4));
+      pass = (bad.set_moves(100, moves) == GrpErr_ElementValueMissing);
+      moves.push_back(SparsePermutation::Move_t(4, 9));
+      pass = pass && (bad.set_moves(100, moves) == GrpErr_ElementValueDuplicated);
+      moves.back().second = 3;
+      pass = pass && (bad.set_moves(100, moves) == GrpErr_OK) && !bad.is_odd();
+      pass = pass && (bad.to_element(dense) == GrpErr_ElementOverflow);
+      std::cout << " 2: Are moves that are not a permutation refused? ------------------- ";
+      report(pass);
+
+      std::mt19937 rng(2020);
+      std::vector<SparsePermutation> elements;
+
+      for (uint32_t idx = 0; idx < 1000; idx++)
+        {
+          elements.push_back(random_sparse(degree, support, rng));
+        }
+
+      pass = true;
+      for (uint32_t idx = 0; idx + 1 < elements.size(); idx++)
+        {
+          const SparsePermutation &a = elements[idx];
+          const SparsePermutation &b = elements[idx + 1];
+          SparsePermutation ab = a * b;
+
+          pass = pass && ((ab).inverse() == b.inverse() * a.inverse())
+            && ((ab * ab.inverse()).is_identity())
+            && (ab.is_odd() == (a.is_odd() != b.is_odd()))
+            && (b.is_identity() || (ab.get_image(b.get_points()[0]) ==
+                                    a.get_image(b.get_images()[0])));
+        }
+      std::cout << " 3: Do the group laws hold for degree " << degree << "? ";
+      std::cout << std::string(std::max(1, 29 - static_cast<int32_t>(std::to_string(degree).size())), '-')
+                << " ";
+      report(pass);
+
+      // Products whose support stays small, by conjugating
+      const uint32_t products = 1000000;
+      struct timespec start;
+      struct timespec now;
+      SparsePermutation total(degree);
+
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for (uint32_t idx = 0; idx < products; idx++)
+        {
+          const SparsePermutation &g = elements[idx % elements.size()];
+
+          total = g * elements[(idx * 7) % elements.size()] * g.inverse();
+        }
+      clock_gettime(CLOCK_MONOTONIC, &now);
+
+      double seconds = (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+
+      std::cout << products << " conjugates of support " << support << " in degree "
+                << degree << ": " << products / seconds / 1e6 << " million/s\n";
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
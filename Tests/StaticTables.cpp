@@ -0,0 +1,151 @@
+/******************************************************************************/
+/*                                                                            */
+/*  StaticTables.cpp: Compile time tables checked against the run time ones   */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+
+#include <stdint.h>
+
+#include <iostream>
+#include <string>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <CayleyTable.h>
+#include <GroupStream.h>
+#include <OrderProfile.h>
+#include <StaticPermutation.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << "\n";
+  std::cout << "       Checks the compile time Cayley tables against CayleyTable\n";
+}
+
+// Baked into the binary; no work happens at start up
+static constexpr StaticCayleyTable<7, 7> C7_table = make_Cn_table<7>();
+static constexpr StaticCayleyTable<6, 12> D6_table = make_Dn_table<6>();
+static constexpr StaticCayleyTable<4, 24> S4_table = make_S4_table();
+static constexpr StaticCayleyTable<5, 60> A5_table = make_A5_table();
+
+static_assert(StaticPermutation<4>("1230").order() == 4, "4-cycle order");
+static_assert(StaticPermutation<4>("1230").is_odd(), "4-cycle parity");
+static_assert(StaticPermutation<5>("12034").inverse() ==
+              StaticPermutation<5>("20134"), "3-cycle inverse");
+static_assert(A5_table.product(0, 59) == 59, "identity row");
+
+template <uint32_t N, uint32_t Size>
+static bool
+same_table(const StaticCayleyTable<N, Size> &table, Group &G)
+{
+  CayleyTable expected;
+
+  if (expected.generate(G) != GrpErr_OK || expected.size() != Size)
+    {
+      return false;
+    }
+  for (uint32_t row = 0; row < Size; row++)
+    {
+      GroupElement element;
+
+      G.get_element(row, element);
+      if (table.elements[row].get_value() != element.get_element())
+        {
+          return false;
+        }
+      for (uint32_t column = 0; column < Size; column++)
+        {
+          if (table.product(row, column) != expected.product(row, column))
+            {
+              return false;
+            }
+        }
+    }
+  return true;
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  if (argc > 1)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      Group C7;
+      Group D6;
+      Group S4;
+      Group A5;
+
+      C7.generate_Cn(7);
+      D6.generate_Dn(6);
+      S4.generate_Sn(4);
+      A5.generate_An(5);
+
+      std::cout << " 1: Does the static C7 table match CayleyTable? --------------------- ";
+      report(same_table(C7_table, C7));
+      std::cout << " 2: Does the static D6 table match CayleyTable? --------------------- ";
+      report(same_table(D6_table, D6));
+      std::cout << " 3: Does the static S4 table match CayleyTable? --------------------- ";
+      report(same_table(S4_table, S4));
+      std::cout << " 4: Does the static A5 table match CayleyTable? --------------------- ";
+      report(same_table(A5_table, A5));
+
+      // Every operation against GroupElement over all of S6
+      bool agree = true;
+      GrpErr_t err = for_each_Sn(6, [&](const std::string &value) -> bool
+        {
+          char text[7] = {};
+          std::string inverse;
+
+          value.copy(text, 6);
+          StaticPermutation<6> p(text);
+          StaticPermutation<6> q = p * StaticPermutation<6>("123450");
+          std::string product;
+
+          invert_element_value(value, inverse);
+          multiply_element_values(value, "123450", product);
+          agree = (p.get_value() == value &&
+                   q.get_value() == product &&
+                   p.inverse().get_value() == inverse &&
+                   p.is_odd() == is_odd_element_value(value) &&
+                   p.order() == element_value_order(value.c_str(), 6) &&
+                   p.to_element().get_element() == value);
+          return agree;
+        });
+      std::cout << " 5: Do the operations agree with GroupElement over S6? -------------- ";
+      report(err == GrpErr_OK && agree);
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << e.get_error_msg() << "\n";
+      return 1;
+    }
+
+  return 0;
+}
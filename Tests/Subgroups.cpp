@@ -0,0 +1,217 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Subgroups.cpp: Tests for cosets, normality and related subgroup work      */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <iostream>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <QuotientGroup.h>
+#include "TestHelpers.h"
+
+void
+usage(char *cmd)
+{
+  std::cout << cmd << " <order>\n";
+  std::cout << "       Runs the subgroup tests within Sn for the given order [4-8]\n";
+}
+
+int32_t
+main(int32_t argc, char *argv[])
+{
+  uint32_t order = 4;
+
+  if (argc > 1)
+    {
+      order = atoi(argv[1]);
+    }
+  if (order < 4 || order > 8)
+    {
+      usage(argv[0]);
+      return 0;
+    }
+
+  try
+    {
+      Group Sn;
+      Group An;
+      Group Dn;
+      Group Cn;
+      std::vector<uint32_t> coset_ids;
+      std::vector<uint32_t> transversal;
+
+      Sn.generate_Sn(order);
+      An.generate_An(order);
+      Dn.generate_Dn(order);
+      Cn.generate_Cn(order);
+
+      std::cout << "|Sn| = " << Sn.size() << " |An| = " << An.size()
+                << " |Dn| = " << Dn.size() << " |Cn| = " << Cn.size() << "\n";
+
+      std::cout << " 1: Is [Sn:An] two? ------------------------------------------------- ";
+      report(Sn.subgroup_index(An) == 2);
+
+      std::cout << " 2: Is An normal in Sn? -------------------------------------------- ";
+      report(Sn.is_normal(An));
+
+      std::cout << " 3: Is Dn not normal in Sn? ---------------------------------------- ";
+      report(!Sn.is_normal(Dn));
+
+      std::cout << " 4: Is Cn normal in Dn? -------------------------------------------- ";
+      report(Dn.is_normal(Cn));
+
+      std::cout << " 5: Do the left cosets of Dn partition Sn evenly? ------------------ ";
+      bool even = (Sn.left_cosets(Dn, coset_ids, transversal) == GrpErr_OK);
+      std::vector<uint32_t> coset_sizes(transversal.size(), 0);
+      for (uint32_t idx = 0; even && idx < coset_ids.size(); idx++)
+        {
+          coset_sizes[coset_ids[idx]]++;
+        }
+      for (uint32_t idx = 0; even && idx < coset_sizes.size(); idx++)
+        {
+          even = (coset_sizes[idx] == Dn.size());
+        }
+      report(even && transversal.size() * Dn.size() == Sn.size());
+
+      std::cout << " 6: Do the left and right cosets of Dn differ? --------------------- ";
+      std::vector<uint32_t> right_ids;
+      Sn.right_cosets(Dn, right_ids);
+      report(right_ids != coset_ids);
+
+      std::cout << " 7: Do the left and right cosets of An agree? ---------------------- ";
+      Sn.left_cosets(An, coset_ids);
+      Sn.right_cosets(An, right_ids);
+      report(right_ids == coset_ids);
+
+      std::cout << " 8: Is Sn rejected as a subgroup of An? ---------------------------- ";
+      report(An.left_cosets(Sn, coset_ids) == GrpErr_MissingElement
+             && An.subgroup_index(Sn) == 0);
+
+      QuotientGroup Q;
+
+      std::cout << " 9: Is Sn/An the cyclic group of order two? ------------------------ ";
+      report(Q.generate(Sn, An) == GrpErr_OK && Q.size() == 2
+             && Q.multiply(1, 1) == Q.get_identity() && Q.inverse(1) == 1);
+
+      std::cout << "10: Is the projection Dn -> Dn/Cn a homomorphism? ----------------- ";
+      bool homomorphism = (Q.generate(Dn, Cn) == GrpErr_OK && Q.size() == 2);
+      for (uint32_t a = 0; homomorphism && a < Dn.size(); a++)
+        {
+          for (uint32_t b = 0; homomorphism && b < Dn.size(); b++)
+            {
+              uint32_t ab;
+
+              homomorphism = Dn.multiply_indices(a, b, ab)
+                && Q.project(ab) == Q.multiply(Q.project(a), Q.project(b));
+            }
+        }
+      report(homomorphism);
+
+      std::cout << "11: Is the quotient by a non normal subgroup refused? -------------- ";
+      report(Q.generate(Sn, Dn) == GrpErr_NotNormalSubgroup && Q.size() == 0);
+
+      Group S;
+
+      std::cout << "12: Is the center of Sn trivial? ---------------------------------- ";
+      report(Sn.center(S) == GrpErr_OK && S.size() == 1);
+
+      std::cout << "13: Is the center of Dn the half turn for even n? ----------------- ";
+      report(Dn.center(S) == GrpErr_OK && S.size() == ((order % 2) ? 1u : 2u));
+
+      std::cout << "14: Is the centralizer of an n-cycle in Sn Cn? -------------------- ";
+      GroupElement cycle;
+      Cn.get_element(1, cycle);
+      Sn.centralizer(cycle, S);
+      uint32_t in_Cn = 0;
+      for (uint32_t idx = 0; idx < S.size(); idx++)
+        {
+          GroupElement e;
+          S.get_element(idx, e);
+          in_Cn += Cn.contains(e);
+        }
+      report(S.size() == order && in_Cn == order);
+
+      std::cout << "15: Is the normalizer of An in Sn all of Sn? ---------------------- ";
+      report(Sn.normalizer(An, S) == GrpErr_OK && S.size() == Sn.size());
+
+      std::cout << "16: Is the normalizer of Cn in Sn of order n phi(n)? -------------- ";
+      uint32_t phi = 0;
+      for (uint32_t k = 1; k <= order; k++)
+        {
+          uint32_t a = k;
+          uint32_t b = order;
+          while (b != 0)
+            {
+              uint32_t t = a % b;
+              a = b;
+              b = t;
+            }
+          phi += (a == 1);
+        }
+      report(Sn.normalizer(Cn, S) == GrpErr_OK && S.size() == order * phi);
+
+      std::vector<Group> series;
+
+      std::cout << "17: Is [Sn,Sn] = An? ---------------------------------------------- ";
+      report(Sn.commutator_subgroup(S) == GrpErr_OK && S.size() == An.size());
+
+      std::cout << "18: Is Sn solvable exactly for n < 5? ----------------------------- ";
+      Sn.derived_series(series);
+      std::cout << "(";
+      for (uint32_t idx = 0; idx < series.size(); idx++)
+        {
+          std::cout << (idx ? " > " : "") << series[idx].size();
+        }
+      std::cout << ") ";
+      report(Sn.is_solvable() == (order < 5));
+
+      std::vector<Group> empty_series;
+      Group empty;
+
+      std::cout << "19: Is Dn solvable and an empty group not? ------------------------ ";
+      report(Dn.is_solvable() && !empty.is_solvable()
+             && empty.derived_series(empty_series) == GrpErr_ElementValueNull
+             && empty_series.empty());
+
+      std::cout << "20: Is a group given only by generators handled? ------------------ ";
+      Group generated;
+      generated.set_generators(Sn.get_generators());
+      generated.commutator_subgroup(S);
+      report(generated.size() == 0 && S.size() == An.size()
+             && generated.is_solvable() == (order < 5));
+
+      std::cout << "21: Does generating from Dn's generators give Dn? ----------------- ";
+      generated.generate(Dn.get_generators());
+      report(generated.size() == Dn.size());
+    }
+  catch (GroupError &e)
+    {
+      std::cerr << "Error: " << e.get_error_code()
+                << ": " << e.get_error_msg() << "\n";
+    }
+  return 0;
+}
@@ -0,0 +1,132 @@
+/******************************************************************************/
+/*                                                                            */
+/*  TestHelpers.h: Helpers shared by the test programs                        */
+/*                                                                            */
+/*  Copyright 2020 Dennis Paul Fleming                                        */
+/*                                                                            */
+/*  This software is free software: you can redistribute it and/or modify     */
+/*  it under the terms of the GNU General Public License as published by      */
+/*  the Free Software Foundation, either version 3 of the License, or         */
+/*  (at your option) any later version.                                       */
+/*                                                                            */
+/*  This program is distributed in the hope that it will be useful,           */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             */
+/*  GNU General Public License for more details.                              */
+/*                                                                            */
+/*  You should have received a copy of the GNU General Public License         */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.     */
+/*                                                                            */
+/*                                                                            */
+/* Version History                                                            */
+/*  1.0: Initial version                                                      */
+/*       October 19 2026:                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#ifndef TEST_HELPERS_H__
+#define TEST_HELPERS_H__
+
+#include <stdint.h>
+#include <time.h>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <GroupElement.h>
+#include <Group.h>
+#include <CycleNotation.h>
+
+// Ends a numbered "NN: Does X? ----- " line with its verdict
+inline void
+report(bool pass)
+{
+  std::cout << (pass ? "PASS\n" : "FAIL\n");
+}
+
+// An element from digits or cycles; a typo in a test is a ParseError
+inline GroupElement
+cycles_element(const std::string &text, uint32_t order)
+{
+  GroupElement e;
+
+  if (parse_element_text(text, order, e) != GrpErr_OK)
+    {
+      throw GroupError(GrpErr_ParseError);
+    }
+  return e;
+}
+
+// Same size and every element of B found in A
+inline bool
+same_elements(Group &A, Group &B)
+{
+  GroupElement e;
+
+  if (A.size() != B.size())
+    {
+      return false;
+    }
+  for (uint32_t idx = 0; idx < B.size(); idx++)
+    {
+      if (!B.get_element(idx, e) || !A.contains(e))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+// Wall clock seconds since start was taken from CLOCK_MONOTONIC
+inline double
+seconds_since(const struct timespec &start)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+// A uniformly shuffled element of Sn
+inline GroupElement
+random_element(uint32_t order, std::mt19937 &rng)
+{
+  GroupElement element;
+  std::string value;
+
+  for (uint32_t i = 0; i < order; i++)
+    {
+      value += '0' + i;
+    }
+  std::shuffle(value.begin(), value.end(), rng);
+  element.set_order(order);
+  element.set_element(value);
+  return element;
+}
+
+// Count of 1 <= k <= n coprime to n, the elements of order n in Cn
+inline uint32_t
+euler_phi(uint32_t n)
+{
+  uint32_t phi = 0;
+
+  for (uint32_t k = 1; k <= n; k++)
+    {
+      uint32_t a = k;
+      uint32_t b = n;
+
+      while (b != 0)
+        {
+          uint32_t t = a % b;
+          a = b;
+          b = t;
+        }
+      phi += (a == 1);
+    }
+  return phi;
+}
+
+#endif // TEST_HELPERS_H__
@@ -0,0 +1,9 @@
+TARGET := ElementOrders
+
+SRC_INCDIRS = . ../GroupLib
+
+TGT_LDLIBS  := -lGroups -lpthread
+TGT_PREREQS :=  libGroups.a
+TGT_LDFLAGS := -L${TARGET_DIR}
+
+SOURCES := ElementOrders.cpp
@@ -0,0 +1,9 @@
+TARGET := EnumerateSn
+
+SRC_INCDIRS = . ../GroupLib
+
+TGT_LDLIBS  := -lGroups -lpthread
+TGT_PREREQS :=  libGroups.a
+TGT_LDFLAGS := -L${TARGET_DIR}
+
+SOURCES := EnumerateSn.cpp
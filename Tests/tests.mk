@@ -1,4 +1,20 @@
 SUBMAKEFILES := basic_group.mk \
   even_odd.mk \
   generate_group.mk \
-  create_group_table.mk
+  create_group_table.mk \
+  subgroups.mk \
+  element_orders.mk \
+  enumerate_sn.mk \
+  static_tables.mk \
+  polygon_groups.mk \
+  batch_multiply.mk \
+  permute_buffers.mk \
+  sparse_permutations.mk \
+  cycle_text.mk \
+  cayley_graphs.mk \
+  factorizations.mk \
+  random_samples.mk \
+  group_actions.mk \
+  block_systems.mk \
+  grow_groups.mk \
+  group_caches.mk